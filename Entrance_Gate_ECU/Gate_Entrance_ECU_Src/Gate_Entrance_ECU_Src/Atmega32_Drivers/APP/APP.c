@@ -33,6 +33,9 @@
 */
 void EntranceGate_ECU_APP_SETUP(void)
 {
+    /*Start the uptime clock first so every module can timestamp its events*/
+    MCAL_TIMER1_StartUptimeClock();
+
     st_UAI_Init();
 
     st_GateController_Init();
@@ -131,26 +131,24 @@ void st_AlarmManager_FailedIDAuthentication(void)
  */
 void st_AlarmManager_SuccessfullIDAuthentication(void)
 {
-    static uint8_t LOC_u8Counter = 0;
-    eLEDStatus_t LOC_eLEDState;
+    LCD_Clear_Screen();
 
-    if(LOC_u8Counter == 0)
-    {
-        LCD_Clear_Screen();
-
-        LCD_Cursor_XY(LCD_SECOND_LINE, 4);
-        LCD_Send_String(stringfy("VALID ID!"));
+    LCD_Cursor_XY(LCD_SECOND_LINE, 4);
+    LCD_Send_String(stringfy("VALID ID!"));
 
-        LOC_eLEDState = LED_On;
+    /*The green LED stays on while the gate is open, approving the next car of a platoon keeps it on*/
+    HAL_LED_SetState(GREEN_LED_PORT, GREEN_LED_PIN, LED_On);
 
-        LOC_u8Counter++;
-    }else{
-        LOC_eLEDState = LED_Off;
-
-        LOC_u8Counter = 0;
-    }
+    fptr_st_AlarmManager = st_AlarmManager_Idle;
+}
 
-    HAL_LED_SetState(GREEN_LED_PORT, GREEN_LED_PIN, LOC_eLEDState);
+/**
+ * @brief This state turns off the green LED after the gate closed.
+ * 
+ */
+void st_AlarmManager_GateClosed(void)
+{
+    HAL_LED_SetState(GREEN_LED_PORT, GREEN_LED_PIN, LED_Off);
 
     fptr_st_AlarmManager = st_AlarmManager_Idle;
 }
@@ -190,7 +188,7 @@ void UAI_AM_ValidID(void)
  */
 void UAI_AM_TurnOffAlarmGateClosed(void)
 {
-    fptr_st_AlarmManager = st_AlarmManager_SuccessfullIDAuthentication;
+    fptr_st_AlarmManager = st_AlarmManager_GateClosed;
 }
 
 /**
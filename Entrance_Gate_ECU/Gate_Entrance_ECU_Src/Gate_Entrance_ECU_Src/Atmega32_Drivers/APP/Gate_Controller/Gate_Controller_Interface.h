@@ -31,7 +31,7 @@
 /** @defgroup MCAL
   * @{
   */
-#include "../MCAL/Timer0/Atmega32_Timer0.h"
+#include "../MCAL/Timer1/Atmega32_Timer1.h"
 /**
   * @}
   */
@@ -85,6 +85,13 @@ void st_GateController_Idle(void);
  */
 void st_GateController_OpenGate(void);
 
+/**
+ * @brief This state starts the minimum open time of the fully opened gate 
+ * then waits for the car to pass the gate.
+ * 
+ */
+void st_GateController_GateOpened(void);
+
 /**
  * @brief This state checks if the car passed the gate 
  * to avoid closing the gate while the car is under it.
@@ -93,10 +100,16 @@ void st_GateController_OpenGate(void);
 void st_GateController_CheckCarPassed(void);
 
 /**
- * @brief This state closes the garage's entrance gate and 
- * sends a GateClosed signal to the User_Admin_Interface moudle.
+ * @brief This state starts closing the garage's entrance gate.
  * 
  */
 void st_GateController_CloseGate(void);
 
+/**
+ * @brief This state runs once the gate is fully closed and 
+ * sends a GateClosed signal to the User_Admin_Interface moudle.
+ * 
+ */
+void st_GateController_GateClosed(void);
+
 #endif /* GATE_CONTROL_INTERFACE_H_ */
\ No newline at end of file
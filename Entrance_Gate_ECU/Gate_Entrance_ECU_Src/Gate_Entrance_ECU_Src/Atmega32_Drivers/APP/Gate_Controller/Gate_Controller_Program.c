@@ -19,17 +19,54 @@
 /** @defgroup PIR CONFIGURATION
   * @{
   */
-#define PIR_PORT        GPIOB
+#define PIR_PORT        GPIOD
 #define PIR_PIN         GPIO_PIN2
+#define PIR_EXTI_LINE   EXTI_INT0
 /**
   * @}
   */
 
 /**
- * @brief Specifies the time the gate should stay open for in milliseconds.
+ * @brief Specifies the minimum time in milliseconds the gate stays fully open before it can close,
+ * it gives the car the time to reach the PIR sensor.
  * 
  */
-#define GATE_OPENED_TIME_MS             500
+#define GATE_MIN_OPEN_TIME_MS           500
+
+/**
+ * @brief Specifies the time in milliseconds the PIR sensor must stay clear after the car leaves it 
+ * before the gate closes, it filters the short gaps in the sensor output while a car passes.
+ * 
+ */
+#define PASSAGE_CLEAR_HOLD_OFF_MS       150
+
+/**
+ * @brief Specifies how long in milliseconds the open gate waits with a clear passage for an approved car 
+ * that didn't pass yet before it closes anyway.
+ * 
+ */
+#define GATE_PLATOON_MAX_WAIT_MS        5000
+
+/*Maximum number of approved cars waiting to pass the gate*/
+#define GATE_MAX_VEHICLES_TO_PASS       0xFFu
+
+/**
+  * @}
+  */
+
+/** @defgroup Global variables
+  * @{
+  */
+
+/*Passage status, updated by the PIR sensor edge interrupt*/
+static volatile boolean Glob_boolPassageOccupied = FALSE;
+static volatile boolean Glob_boolVehicleDetected = FALSE;
+static volatile uint32_t Glob_u32PassageClearTimeMs = 0;
+
+/*Number of approved cars that didn't pass the gate yet, the gate stays open while it's not zero*/
+static volatile uint8_t Glob_u8VehiclesToPass = 0;
+
+static uint32_t Glob_u32GateOpenedTimeMs = 0;
 
 /**
   * @}
@@ -39,9 +76,33 @@
 /** @defgroup ISR_CALLBACK_FUNCTIONS
   * @{
   */
-static void Timer0_DelaycheckCar_Callback(void)
+static void PIR_PassageEdge_Callback(void)
 {
-    fptr_st_GateController = st_GateController_CheckCarPassed;
+    if(PIR_MotionDetected == HAL_PIR_ReadStatus(PIR_PORT, PIR_PIN))
+    {
+        Glob_boolPassageOccupied = TRUE;
+        Glob_boolVehicleDetected = TRUE;
+    }else{
+        /*The clearing edge starts the hold-off time before closing*/
+        Glob_boolPassageOccupied = FALSE;
+        Glob_u32PassageClearTimeMs = MCAL_TIMER1_Millis();
+    }
+}
+
+static void ServoMotor_GateOpened_Callback(void)
+{
+    fptr_st_GateController = st_GateController_GateOpened;
+}
+
+static void ServoMotor_GateClosed_Callback(void)
+{
+    /*A car approved while the gate was closing opens it again*/
+    if(0u == Glob_u8VehiclesToPass)
+    {
+        fptr_st_GateController = st_GateController_GateClosed;
+    }else{
+
+    }
 }
 
 /**
@@ -65,6 +126,8 @@ void st_GateController_Init(void)
     
     /*Initialize the PIR sensor to detect when the car successfully passes the gate*/
     HAL_PIR_Init(PIR_PORT, PIR_PIN);
+    HAL_PIR_EnableEdgeInterrupt(PIR_EXTI_LINE, PIR_PassageEdge_Callback);
+    Glob_boolPassageOccupied = (PIR_MotionDetected == HAL_PIR_ReadStatus(PIR_PORT, PIR_PIN))? TRUE : FALSE;
 
     /*Set the initial state to be idle until there is a request to be processed*/
     fptr_st_GateController = st_GateController_Idle;
@@ -84,60 +147,117 @@ void st_GateController_Idle(void)
 /**
  * @brief This state opens the garage's entrance gate.
  * 
- * @note :The gate opens by turning the servo motor +90 degree
+ * @note :The gate opens by turning the servo motor +90 degree, a gate that is still 
+ * closing turns back without stopping.
  */
 void st_GateController_OpenGate(void)
 {   
-    /*Turns the servo motor to open the gate*/
-    HAL_ServoMotorTurn(ServoMotor_90Degree);
-
-    /** TODO: Wait for 3 seconds then move to the state that 
-     * checks if the car already passed the gate using the PIR sensor.
-    */
-    MCAL_TIMER0_SingleIntervalDelayms(GATE_OPENED_TIME_MS, Timer0_DelaycheckCar_Callback);
+    /*Starts turning the servo motor to open the gate*/
+    HAL_ServoMotorTurn(ServoMotor_90Degree, ServoMotor_GateOpened_Callback);
 
-    /*Idle until the delay is over*/
+    /*Idle until the gate is fully opened*/
     fptr_st_GateController = st_GateController_Idle;
 }
 
+/**
+ * @brief This state starts the minimum open time of the fully opened gate 
+ * then waits for the car to pass the gate.
+ * 
+ */
+void st_GateController_GateOpened(void)
+{
+    Glob_u32GateOpenedTimeMs = MCAL_TIMER1_Millis();
+
+    fptr_st_GateController = st_GateController_CheckCarPassed;
+}
+
 /**
  * @brief This state checks if the car passed the gate 
  * to avoid closing the gate while the car is under it.
  * 
+ * @note A car passed once the PIR sensor stayed clear for the hold-off time after its clearing edge,
+ * the gate closes after the minimum open time when all the approved cars passed.
  */
 void st_GateController_CheckCarPassed(void)
 {
-    ePIRStatus_t LOC_ePIRStatus;
+    boolean LOC_boolPassageClear;
+    boolean LOC_boolVehiclePassed = FALSE;
+    uint32_t LOC_u32ClearTimeMs;
+    uint32_t LOC_u32NowMs;
+    uint8_t LOC_u8SREG;
+
+    LOC_u32NowMs = MCAL_TIMER1_Millis();
 
-    LOC_ePIRStatus = HAL_PIR_ReadStatus(PIR_PORT, PIR_PIN);
+    /*Check the passage status updated by the edge interrupt, a car passed once it was detected and 
+      the passage stayed clear for the hold-off time*/
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
 
-    /*If no motion is detected then the car passed so we should close the gate*/
-    if(PIR_NoMotionDetected == LOC_ePIRStatus)
+    LOC_u32ClearTimeMs = Glob_u32PassageClearTimeMs;
+    LOC_boolPassageClear = ((FALSE == Glob_boolPassageOccupied) && 
+                            TIMER1_TIME_IS_REACHED(LOC_u32NowMs, LOC_u32ClearTimeMs + PASSAGE_CLEAR_HOLD_OFF_MS))? TRUE : FALSE;
+
+    if((TRUE == LOC_boolPassageClear) && (TRUE == Glob_boolVehicleDetected))
     {
+        Glob_boolVehicleDetected = FALSE;
+        LOC_boolVehiclePassed = TRUE;
+    }else{
 
-      fptr_st_GateController = st_GateController_CloseGate;
+    }
 
-    }else{ /*If the car didn't pass the gate yet then we should wait for another 
-             gate timer interval.*/
+    SREG = LOC_u8SREG;
 
-      MCAL_TIMER0_SingleIntervalDelayms(GATE_OPENED_TIME_MS, Timer0_DelaycheckCar_Callback);
+    if((TRUE == LOC_boolVehiclePassed) && (Glob_u8VehiclesToPass > 0u))
+    {
+        Glob_u8VehiclesToPass--;
+    }else{
+
+    }
+
+    /*The wait for the next approved car starts when the gate opened or when the last car left*/
+    if(TIMER1_TIME_IS_AFTER(Glob_u32GateOpenedTimeMs, LOC_u32ClearTimeMs))
+    {
+        LOC_u32ClearTimeMs = Glob_u32GateOpenedTimeMs;
+    }else{
+
+    }
+
+    /*Close the gate once every approved car passed, or the next one didn't come in time*/
+    if((TRUE == LOC_boolPassageClear) &&
+       TIMER1_TIME_IS_REACHED(LOC_u32NowMs, Glob_u32GateOpenedTimeMs + GATE_MIN_OPEN_TIME_MS) &&
+       ((0u == Glob_u8VehiclesToPass) || TIMER1_TIME_IS_REACHED(LOC_u32NowMs, LOC_u32ClearTimeMs + GATE_PLATOON_MAX_WAIT_MS)))
+    {
+      /*A car that didn't show up has to scan its card again*/
+      Glob_u8VehiclesToPass = 0;
+
+      fptr_st_GateController = st_GateController_CloseGate;
+
+    }else{ /*If the car didn't pass the gate yet then we stay in this state*/
 
-      /*Return to the idle state*/
-      fptr_st_GateController = st_GateController_Idle;
     }
       
 }
 
 /**
- * @brief This state closes the garage's entrance gate and 
- * sends a GateClosed signal to the User_Admin_Interface moudle.
+ * @brief This state starts closing the garage's entrance gate.
  * 
  */
 void st_GateController_CloseGate(void)
 {
-    /*Turns the servo motor to close the gate*/
-    HAL_ServoMotorTurn(ServoMotor_0Degree);
+    /*Starts turning the servo motor to close the gate*/
+    HAL_ServoMotorTurn(ServoMotor_0Degree, ServoMotor_GateClosed_Callback);
 
+    /*Idle until the gate is fully closed*/
+    fptr_st_GateController = st_GateController_Idle;
+}
+
+/**
+ * @brief This state runs once the gate is fully closed and 
+ * sends a GateClosed signal to the User_Admin_Interface moudle.
+ * 
+ */
+void st_GateController_GateClosed(void)
+{
     /*Sends a signal to the User_Admin_Interface to inform it that the gate closed*/
     GC_UAI_GateClosed();
 
@@ -153,9 +273,33 @@ void st_GateController_CloseGate(void)
  * @brief This is an outgoing signal from the User_Admin_Interface module to the Gate_Controller module
  * to request it to open the gate.
  * 
+ * @note A request while the gate is open keeps it open for one more car, and a request while 
+ * it's closing opens it again.
  */
 void UAI_GC_OpenGateReuest(void)
 {
+    uint8_t LOC_u8SREG;
+
+    if(0u == Glob_u8VehiclesToPass)
+    {
+        /*Only a car that is in the passage now belongs to the new request*/
+        LOC_u8SREG = SREG;
+        G_INTERRUPT_DISABLE;
+
+        Glob_boolVehicleDetected = Glob_boolPassageOccupied;
+
+        SREG = LOC_u8SREG;
+    }else{
+
+    }
+
+    if(Glob_u8VehiclesToPass < GATE_MAX_VEHICLES_TO_PASS)
+    {
+        Glob_u8VehiclesToPass++;
+    }else{
+
+    }
+
     fptr_st_GateController = st_GateController_OpenGate;
 }
 
@@ -28,6 +28,9 @@
 /*The size of the driver's ID*/
 #define DRIVER_ID_SIZE                  3
 
+/*The admin ECU protocol carries DRIVER_ID_SIZE characters, so the driver's ID is the end of the card tag*/
+#define DRIVER_ID_TAG_OFFSET            (RFID_TAG_SIZE - DRIVER_ID_SIZE)
+
 /** @defgroup The configuration of the pin connected to the EXTI line of th admin ECU
   * @{
   */
@@ -37,11 +40,61 @@
   * @}
   */
 
+/** @defgroup REQUEST_TIMEOUT
+  * @brief The timeout of a request follows the smoothed round trip time of the admin ECU (SRTT and RTTVAR
+  * as in TCP), an unanswered request is retried with a jittered exponential backoff before it fails.
+  * @{
+  */
+#define REQUEST_RTO_INITIAL_MS          1000u       /*Timeout until the first round trip is measured*/
+#define REQUEST_RTO_MIN_MS              100u
+#define REQUEST_RTO_MAX_MS              3000u       /*Cap of the measured RTO, the backoff goes on top of it*/
+#define REQUEST_MAX_RETRIES             2u
+
+/*SRTT is kept times 8 and RTTVAR times 4, so the gains of 1/8 and 1/4 are shifts*/
+#define REQUEST_SRTT_SHIFT              3u
+#define REQUEST_RTTVAR_SHIFT            2u
+
+/*Time the admin ECU takes to serve one queued request, the wait for a queued request grows with its position*/
+#define REQUEST_SERVICE_TIME_MS         500u
+
+/*Time a waiting listed driver waits at the gate for a free slot before being told the garage is full, the admin ECU
+  gives the place up a little earlier*/
+#define REQUEST_WAITLIST_TIMEOUT_MS     300000u
 /**
- * @brief Time delay in ms before considering the system to be stuck and reset it.
- * 
- */
-#define TIME_BEFORE_RESET_MS            1000u      
+  * @}
+  */
+
+/** @defgroup ID_AHEAD_QUEUE
+  * @brief Cards read while a driver is being served wait here for their authentication.
+  * @{
+  */
+#define ID_AHEAD_QUEUE_SIZE             2u
+#define ID_AHEAD_QUEUE_MASK             (ID_AHEAD_QUEUE_SIZE - 1u)
+
+#if ((ID_AHEAD_QUEUE_SIZE & ID_AHEAD_QUEUE_MASK) != 0u) || (ID_AHEAD_QUEUE_SIZE > 128u)
+#error "ID_AHEAD_QUEUE_SIZE must be a power of 2 not larger than 128"
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup RECENT_TAPS
+  * @brief The last cards read are kept in a table indexed by a hash of the ID, a card read again within
+  * the window is dropped so repeated taps and readers repeating a card in range cost no request.
+  * @{
+  */
+#define RECENT_TAP_TABLE_SIZE           4u
+#define RECENT_TAP_TABLE_MASK           (RECENT_TAP_TABLE_SIZE - 1u)
+
+/*A repeat restarts the window, so a card held in range stays suppressed*/
+#define RECENT_TAP_WINDOW_MS            1500u
+
+#if ((RECENT_TAP_TABLE_SIZE & RECENT_TAP_TABLE_MASK) != 0u) || (RECENT_TAP_TABLE_SIZE > 128u)
+#error "RECENT_TAP_TABLE_SIZE must be a power of 2 not larger than 128"
+#endif
+/**
+  * @}
+  */
 
 /** @defgroup Module_States
   * @{
@@ -49,6 +102,9 @@
 #define UAI_IDLE                            0
 #define UAI_SENDING_ID                      1
 #define UAI_WAITING_AUTHENTICATION_RESULT   2
+#define UAI_AUTHENTICATION_DONE             3
+#define UAI_RETRY_SCHEDULED                 4
+#define UAI_WAITLISTED                      5
 /**
   * @}
   */
@@ -62,17 +118,255 @@
   * @}
   */
 
+/** @defgroup RESULT_DETAIL
+  * @brief A result frame is {result, slots left, detail}, the detail packs the reason of a refusal in its
+  * high nibble and the message to show in its low nibble.
+  * @{
+  */
+#define RESULT_DETAIL_REASON(DETAIL)        ((uint8_t)(DETAIL) >> 4)
+#define RESULT_DETAIL_MSG(DETAIL)           ((uint8_t)(DETAIL) & 0x0Fu)
+
+#define RESULT_REASON_NONE                  0x0u
+#define RESULT_REASON_NOT_AUTHORIZED        0x1u
+#define RESULT_REASON_RATE_LIMITED          0x2u
+#define RESULT_REASON_GARAGE_FULL           0x3u
+
+#define RESULT_MSG_NONE                     0x0u
+#define RESULT_MSG_WELCOME                  0x1u
+#define RESULT_MSG_GOODBYE                  0x2u
+#define RESULT_MSG_CONTACT_ADMIN            0x3u
 /**
   * @}
   */
 
+/** @defgroup ADMIN_REPLY
+  * @brief The admin ECU answers an authentication request right away with one of these replies and sends
+  * the result once the request is served, every answer frame is {code, argument, detail}.
+  * @{
+  */
+#define ADMIN_REPLY_ACCEPTED            0xA1u       /*The argument is the position of the request in the queue*/
+#define ADMIN_REPLY_BUSY                0xB5u       /*The argument is the retry delay in ADMIN_REPLY_RETRY_UNIT_MS*/
+#define ADMIN_REPLY_WAITLISTED          0x5Au       /*The garage is full, the argument is the place in the waiting list*/
+#define ADMIN_REPLY_ADMITTED            0xADu       /*A slot freed up for the waiting driver, sent like a passed result*/
+#define ADMIN_REPLY_RETRY_UNIT_MS       10u
+
+#define ADMIN_REPLY_CODE_INDEX          0u
+#define ADMIN_REPLY_ARGUMENT_INDEX      1u
+#define ADMIN_REPLY_DETAIL_INDEX        2u
+#define ADMIN_REPLY_FRAME_SIZE          3u
+/**
+  * @}
+  */
 
-/** @defgroup Local Variables
+/** @defgroup REQUEST_FRAME
+  * @brief A request frame is {gate address, request type, cache version, driver ID}.
+  * @{
+  */
+#define REQUEST_TYPE_INDEX              1u
+#define REQUEST_VERSION_INDEX           2u
+#define REQUEST_FRAME_SIZE              (REQUEST_VERSION_INDEX + 1u + DRIVER_ID_SIZE)
+
+/*Request types*/
+#define REQUEST_AUTHENTICATE            0x01u       /*The admin ECU answers with the authentication result*/
+#define REQUEST_ENTRY_NOTIFY            0x02u       /*The ID was found in the cache and the gate already opened*/
+#define REQUEST_CACHE_SYNC              0x03u       /*Asks the admin ECU to confirm the cache version*/
+#define REQUEST_OFFLINE_ENTRY           0x04u       /*Replays a journaled vehicle let in while the admin ECU was unreachable*/
+/**
+  * @}
+  */
+
+/** @defgroup AUTHORIZATION_CACHE
+  * @brief Local copy of the allow-list kept up to date by the admin ECU, a cached ID opens the gate 
+  * without waiting for the admin ECU.
+  * @{
+  */
+#define AUTH_CACHE_SIZE                 8u
+
+/*A cached ID is only trusted this long after the admin ECU last confirmed the cache version,
+  which bounds the time a revoked ID can still open the gate when its update is lost*/
+#define AUTH_CACHE_MAX_AGE_MS           2000u
+
+/*Age of the cache at which a sync is requested from the admin ECU*/
+#define AUTH_CACHE_REFRESH_MS           1000u
+
+/*A cache update frame that isn't complete within this time is dropped*/
+#define AUTH_CACHE_FRAME_TIMEOUT_MS     5u
+
+#define AUTH_CACHE_FRAME_START_BYTE     0xC3u
+
+/*A cache update frame is {operation, version, driver ID}*/
+#define AUTH_CACHE_FRAME_OP_INDEX       0u
+#define AUTH_CACHE_FRAME_VERSION_INDEX  1u
+#define AUTH_CACHE_FRAME_ID_INDEX       2u
+#define AUTH_CACHE_FRAME_SIZE           (AUTH_CACHE_FRAME_ID_INDEX + DRIVER_ID_SIZE)
+
+/*Operations, ADD and REMOVE apply on top of the previous version and LOAD on the same version*/
+#define AUTH_CACHE_OP_SYNC              0x01u
+#define AUTH_CACHE_OP_ADD               0x02u
+#define AUTH_CACHE_OP_REMOVE            0x03u
+#define AUTH_CACHE_OP_CLEAR             0x04u
+#define AUTH_CACHE_OP_LOAD              0x05u
+#define AUTH_CACHE_OP_OCCUPANCY         0x06u       /*The first ID byte is the places left, only sent to the entrance gate*/
+
+/*Version 0 means the cache was never synchronized, it's skipped when the version wraps*/
+#define AUTH_CACHE_VERSION_UNSYNCED     0u
+#define AUTH_CACHE_NEXT_VERSION(VER)    (((VER) == 0xFFu)? 1u : (uint8_t)((VER) + 1u))
+/**
+  * @}
+  */
+
+/** @defgroup OFFLINE_STORE
+  * @brief EEPROM copy of the authorization cache used to let drivers in while the admin ECU is unreachable,
+  * and the journal of the vehicles let in meanwhile which is replayed once the admin ECU answers again.
+  * @{
+  */
+/*The snapshot is a record of {count, IDs}*/
+#define SNAPSHOT_EEPROM_ADDRESS         0x000u
+#define SNAPSHOT_COUNT_INDEX            0u
+#define SNAPSHOT_IDS_OFFSET             1u
+#define SNAPSHOT_SIZE                   (SNAPSHOT_IDS_OFFSET + (AUTH_CACHE_SIZE * DRIVER_ID_SIZE))
+
+/*Time without cache changes before the snapshot is rewritten, so a cache reload is written once*/
+#define SNAPSHOT_SAVE_DELAY_MS          1000u
+
+/*The journal indices are a record of {head, tail}, they are free running and the journal is empty when they are equal*/
+#define JOURNAL_INDEX_EEPROM_ADDRESS    0x040u
+#define JOURNAL_INDEX_HEAD              0u
+#define JOURNAL_INDEX_TAIL              1u
+#define JOURNAL_INDEX_SIZE              2u
+#define JOURNAL_RECORDS_EEPROM_ADDRESS  0x048u
+#define JOURNAL_SIZE                    32u
+#define JOURNAL_MASK                    (JOURNAL_SIZE - 1u)
+
+#if ((JOURNAL_SIZE & JOURNAL_MASK) != 0u) || (JOURNAL_SIZE > 128u)
+#error "JOURNAL_SIZE must be a power of 2 not larger than 128"
+#endif
+
+#if ((SNAPSHOT_EEPROM_ADDRESS + EEPROM_RECORD_FOOTPRINT(SNAPSHOT_SIZE)) > JOURNAL_INDEX_EEPROM_ADDRESS) || \
+    ((JOURNAL_INDEX_EEPROM_ADDRESS + EEPROM_RECORD_FOOTPRINT(JOURNAL_INDEX_SIZE)) > JOURNAL_RECORDS_EEPROM_ADDRESS) || \
+    ((JOURNAL_RECORDS_EEPROM_ADDRESS + (JOURNAL_SIZE * DRIVER_ID_SIZE)) > EEPROM_SIZE)
+#error "The offline store doesn't fit its EEPROM layout"
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup IDLE_ACTIONS
+  * @brief EEPROM accesses decided by st_UAI_Idle, they are done after the interrupts are enabled again.
+  * @{
+  */
+#define IDLE_ACTION_NONE                0u
+#define IDLE_ACTION_JOURNAL_ENTRY       1u
+#define IDLE_ACTION_SAVE_SNAPSHOT       2u
+#define IDLE_ACTION_REPLAY_JOURNAL      3u
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+/** @defgroup Local Types
   * @{
   */
-static uint8_t Glob_u8ModuleCurrentState;
+typedef struct{
+    uint8_t  au8DriverID[DRIVER_ID_SIZE];       /*!<The driver's ID taken from the card tag*/
+    uint32_t u32CardReadTimeMs;                 /*!<Uptime when the card was read*/
+}sUAI_CardRead_t;
+
+typedef struct{
+    uint8_t  au8DriverID[DRIVER_ID_SIZE];
+    uint32_t u32TapTimeMs;                      /*!<Uptime when the card was last read*/
+    boolean  boolValid;
+}sUAI_RecentTap_t;
+/**
+  * @}
+  */
 
-static uint8_t Glob_u8DriverID[DRIVER_ID_SIZE + 1];
+/** @defgroup Local Variables
+  * @{
+  */
+static volatile uint8_t Glob_u8ModuleCurrentState;
+
+/*Cards read ahead, filled by the UART ISR and taken when their authentication starts,
+  the indices are free running and the queue is empty when they are equal*/
+static sUAI_CardRead_t Glob_asIDAheadQueue[ID_AHEAD_QUEUE_SIZE];
+static volatile uint8_t Glob_u8IDAheadHead = 0;
+static volatile uint8_t Glob_u8IDAheadTail = 0;
+
+/*Cards read lately, only used by the UART ISR*/
+static sUAI_RecentTap_t Glob_asRecentTaps[RECENT_TAP_TABLE_SIZE];
+
+/*ID of the driver being authenticated*/
+static uint8_t Glob_au8DriverID[DRIVER_ID_SIZE];
+
+/*Progress of the SPI exchange with the admin ECU*/
+static uint8_t Glob_u8RequestType = REQUEST_AUTHENTICATE;
+static uint8_t Glob_u8SentIDChars = 0;
+static boolean Glob_boolDetectedGateAddress = FALSE;
+
+/*Allow-list cache, written by the SPI ISR*/
+static uint8_t Glob_au8AuthCache[AUTH_CACHE_SIZE][DRIVER_ID_SIZE];
+static volatile uint8_t Glob_u8AuthCacheCount = 0;
+static volatile uint8_t Glob_u8AuthCacheVersion = AUTH_CACHE_VERSION_UNSYNCED;
+static volatile uint32_t Glob_u32AuthCacheExpiryMs = 0;
+static volatile uint32_t Glob_u32AuthCacheNextSyncMs = 0;
+
+/*Cache update frame being received*/
+static uint8_t Glob_au8CacheFrame[AUTH_CACHE_FRAME_SIZE];
+static uint8_t Glob_u8CacheFrameIndex = 0;
+static boolean Glob_boolCacheFrameStarted = FALSE;
+static uint32_t Glob_u32CacheFrameStartMs = 0;
+
+/*Uptime after which the admin ECU is considered not to answer the current request*/
+static volatile uint32_t Glob_u32AuthDeadlineMs = 0;
+
+/*Round trip estimation, a retried request isn't sampled as its answer may belong to any of the tries*/
+static uint32_t Glob_u32RequestStartMs = 0;
+static volatile uint8_t Glob_u8RequestRetries = 0;
+static boolean Glob_boolRttSampled = FALSE;
+static boolean Glob_boolRequestSampled = FALSE;
+static uint32_t Glob_u32SrttX8 = 0;
+static uint32_t Glob_u32RttvarX4 = 0;
+static uint32_t Glob_u32RtoMs = REQUEST_RTO_INITIAL_MS;
+
+/*Set when a request isn't answered in time, cleared when a frame is exchanged with the admin ECU again*/
+static volatile boolean Glob_boolAdminOffline = FALSE;
+
+/*The last reply of the admin ECU, shown to the driver while waiting*/
+static uint8_t Glob_au8ReplyFrame[ADMIN_REPLY_FRAME_SIZE];
+static uint8_t Glob_u8ReplyIndex = 0;
+static volatile uint8_t Glob_u8QueuePosition = 0;
+static volatile boolean Glob_boolWaitMsgPending = FALSE;
+
+/*Pushed by the admin ECU, the entries are refused here while the garage is full*/
+static volatile boolean Glob_boolGarageFull = FALSE;
+static volatile boolean Glob_boolOccupancyChanged = FALSE;
+
+/*Slots left and detail of the last result, shown after the result*/
+static uint8_t Glob_u8ResultSlots = 0;
+static uint8_t Glob_u8ResultDetail = 0;
+static volatile boolean Glob_boolResultDetailValid = FALSE;
+
+/*The EEPROM snapshot misses the cache changes done since this uptime*/
+static sEEPROM_Record_t Glob_sSnapshotRecord = {SNAPSHOT_EEPROM_ADDRESS, SNAPSHOT_SIZE};
+static volatile boolean Glob_boolSnapshotDirty = FALSE;
+static volatile uint32_t Glob_u32CacheChangeMs = 0;
+
+/*Copies of the EEPROM journal indices, the record being replayed is dropped once its frame is sent*/
+static sEEPROM_Record_t Glob_sJournalIndexRecord = {JOURNAL_INDEX_EEPROM_ADDRESS, JOURNAL_INDEX_SIZE};
+static uint8_t Glob_u8JournalHead = 0;
+static uint8_t Glob_u8JournalTail = 0;
+static volatile boolean Glob_boolJournalRecordSent = FALSE;
+
+/*Uptime when the current driver's card was read and the service time of the last vehicle*/
+static uint32_t Glob_u32CardReadTimeMs = 0;
+static uint32_t Glob_u32LastServiceTimeMs = 0;
+
+/*TRUE while the UART takes the card reader input*/
+static volatile boolean Glob_boolCardReaderEnabled = FALSE;
 static const uint8_t Glob_u8GateAddress = ENTRANCE_GATE_ECU_ADDRESS;
 /**
   * @}
@@ -86,47 +380,685 @@ static const uint8_t Glob_u8GateAddress = ENTRANCE_GATE_ECU_ADDRESS;
 
 /**
 ======================================================================================================================
-* @Func_name	:  Timer0_SingleIntervalDelaycallback
-* @brief		  :  This function is the callback function for the Timer0_SingleIntervalDelayms function.
+* @Func_name	:   UAI_IsRepeatedTap
+* @brief		:   This function checks if a card was read within the last RECENT_TAP_WINDOW_MS and records it.
+* @param [in]	:   copy_pu8DriverID: The driver's ID of the card.
+* @param [in]	:   copy_u32NowMs: Uptime when the card was read.
+* @return       :   boolean: TRUE if the card is a repeat to be dropped.
+* @note			:   An ID only replaces the one sharing its table entry, so the check is a single compare.
 ======================================================================================================================
 */
-static void Timer0_SingleIntervalDelaycallback(void)
+static boolean UAI_IsRepeatedTap(const uint8_t* copy_pu8DriverID, uint32_t copy_u32NowMs)
 {
-  fptr_st_UserAdminInterface = st_UAI_ShowWelcomeMsg;
+    boolean LOC_boolRepeated = FALSE;
+    uint8_t LOC_u8Hash = 0;
+    uint8_t LOC_u8Index;
+    sUAI_RecentTap_t* LOC_psTap;
+
+    for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+    {
+        LOC_u8Hash = (uint8_t)((LOC_u8Hash << 1) ^ copy_pu8DriverID[LOC_u8Index]);
+    }
+
+    LOC_psTap = &Glob_asRecentTaps[LOC_u8Hash & RECENT_TAP_TABLE_MASK];
+
+    if((TRUE == LOC_psTap->boolValid) &&
+       (TIMER1_TIME_ELAPSED(copy_u32NowMs, LOC_psTap->u32TapTimeMs) < RECENT_TAP_WINDOW_MS))
+    {
+        LOC_boolRepeated = TRUE;
+
+        for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+        {
+            if(LOC_psTap->au8DriverID[LOC_u8Index] != copy_pu8DriverID[LOC_u8Index])
+            {
+                LOC_boolRepeated = FALSE;
+            }else{
+
+            }
+        }
+    }else{
+
+    }
+
+    if(FALSE == LOC_boolRepeated)
+    {
+        for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+        {
+            LOC_psTap->au8DriverID[LOC_u8Index] = copy_pu8DriverID[LOC_u8Index];
+        }
+
+        LOC_psTap->boolValid = TRUE;
+    }else{
+
+    }
+
+    LOC_psTap->u32TapTimeMs = copy_u32NowMs;
+
+    return LOC_boolRepeated;
 }
 
 /**
 ======================================================================================================================
 * @Func_name	:   USART_RX_ISR_Callback
-* @brief		:   This function is the callback function for the USART receive buffer not empty interrupt it helps
-*               :   reading the driver ID from the driver.
+* @brief		:   This function is the callback function for the USART receive buffer not empty interrupt it feeds
+*               :   the bytes sent by the RFID reader to the frame parser and queues every valid card tag.
+* @note			:   The reader stays enabled while a driver is served, so the next driver's card is read ahead.
+*               :   A card read again within RECENT_TAP_WINDOW_MS is dropped.
+======================================================================================================================
+*/
+static void USART_RX_ISR_Callback(void)
+{
+    uint16_t LOC_u16RxData = 0;
+    uint8_t  LOC_u8RxByte;
+    uint8_t  LOC_u8Index;
+    uint32_t LOC_u32NowMs = MCAL_TIMER1_Millis();
+    const uint8_t* LOC_pu8Tag;
+    sUAI_CardRead_t* LOC_psCard;
+
+    if(MCAL_UART_Get_Data(&LOC_u16RxData, USART_PollingDisabled) == E_OK)
+    {
+        LOC_u8RxByte = (uint8_t)LOC_u16RxData;
+
+        /*Queue the byte to show it again on the terminal, the UDRE interrupt sends it
+          so the echo isn't lost when the previous one is still shifting out*/
+        MCAL_UART_Write(&LOC_u8RxByte, 1);
+
+        /*Queue the driver's ID, a card read when the queue is full or read again is dropped*/
+        if((HAL_RFID_ParseByte(LOC_u8RxByte) == RFID_FrameComplete) &&
+           ((uint8_t)(Glob_u8IDAheadHead - Glob_u8IDAheadTail) < ID_AHEAD_QUEUE_SIZE) &&
+           (FALSE == UAI_IsRepeatedTap(HAL_RFID_GetTag() + DRIVER_ID_TAG_OFFSET, LOC_u32NowMs)))
+        {
+            LOC_pu8Tag = HAL_RFID_GetTag() + DRIVER_ID_TAG_OFFSET;
+            LOC_psCard = &Glob_asIDAheadQueue[Glob_u8IDAheadHead & ID_AHEAD_QUEUE_MASK];
+
+            for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+            {
+                LOC_psCard->au8DriverID[LOC_u8Index] = LOC_pu8Tag[LOC_u8Index];
+            }
+
+            LOC_psCard->u32CardReadTimeMs = LOC_u32NowMs;
+
+            /*Publish the entry after it's complete, st_UAI_Idle starts its authentication*/
+            Glob_u8IDAheadHead++;
+        }else{
+
+        }
+    }else{
+        /*A corrupted byte breaks the frame, wait for the next one*/
+        HAL_RFID_Reset();
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_SampleRoundTrip
+* @brief		:   This function updates the request timeout with the round trip time of the current request.
+* @note			:   Called from the SPI ISR when the request is answered, only the first answer to a request 
+*               :   that wasn't retried is a sample, a queued request waits longer for its result.
+======================================================================================================================
+*/
+static void UAI_SampleRoundTrip(void)
+{
+    sint32_t LOC_s32Delta;
+    uint32_t LOC_u32Rtt;
+
+    if((0u == Glob_u8RequestRetries) && (FALSE == Glob_boolRequestSampled))
+    {
+        Glob_boolRequestSampled = TRUE;
+
+        LOC_u32Rtt = TIMER1_TIME_ELAPSED(MCAL_TIMER1_Millis(), Glob_u32RequestStartMs);
+
+        if(FALSE == Glob_boolRttSampled)
+        {
+            /*The first sample sets the average and half of it as the variation*/
+            Glob_boolRttSampled = TRUE;
+            Glob_u32SrttX8 = LOC_u32Rtt << REQUEST_SRTT_SHIFT;
+            Glob_u32RttvarX4 = (LOC_u32Rtt << REQUEST_RTTVAR_SHIFT) >> 1;
+        }else{
+            LOC_s32Delta = (sint32_t)LOC_u32Rtt - (sint32_t)(Glob_u32SrttX8 >> REQUEST_SRTT_SHIFT);
+            Glob_u32SrttX8 = (uint32_t)((sint32_t)Glob_u32SrttX8 + LOC_s32Delta);
+
+            if(LOC_s32Delta < 0)
+            {
+                LOC_s32Delta = -LOC_s32Delta;
+            }else{
+
+            }
+
+            Glob_u32RttvarX4 = (uint32_t)((sint32_t)Glob_u32RttvarX4 + LOC_s32Delta - 
+                                          (sint32_t)(Glob_u32RttvarX4 >> REQUEST_RTTVAR_SHIFT));
+        }
+
+        /*RTO = SRTT + 4 * RTTVAR*/
+        Glob_u32RtoMs = (Glob_u32SrttX8 >> REQUEST_SRTT_SHIFT) + Glob_u32RttvarX4;
+
+        if(Glob_u32RtoMs < REQUEST_RTO_MIN_MS)
+        {
+            Glob_u32RtoMs = REQUEST_RTO_MIN_MS;
+        }else if(Glob_u32RtoMs > REQUEST_RTO_MAX_MS){
+            Glob_u32RtoMs = REQUEST_RTO_MAX_MS;
+        }else{
+
+        }
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_RequestTimeout
+* @brief		:   This function returns the timeout of the current try of the request.
+* @return       :   uint32_t: RTO doubled for every retry plus up to a quarter of it as jitter, so both gates
+*               :   don't retry together. The RTO itself is capped when it's measured, the last try waits
+*               :   up to 1.25 * (REQUEST_RTO_MAX_MS << REQUEST_MAX_RETRIES).
+* @note			:   Called with the interrupts disabled.
+======================================================================================================================
+*/
+static uint32_t UAI_RequestTimeout(void)
+{
+    uint32_t LOC_u32Timeout = Glob_u32RtoMs << Glob_u8RequestRetries;
+
+    LOC_u32Timeout += MCAL_TIMER1_Micros() % ((LOC_u32Timeout >> 2) + 1u);
+
+    return LOC_u32Timeout;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   SPI_SendingID
+* @brief		:   Function to send the driver's ID to the admin through SPI interface.
 * @note			:   none.
 ======================================================================================================================
 */
-static void USART_RX_ISR_Callback(void)
+static void SPI_SendingID(void)
+{
+    if(Glob_u8SentIDChars == 0)
+    {
+        MCAL_SPI_SendData((uint8_t *)&Glob_u8GateAddress, PollingDisable);
+
+    }else if(Glob_u8SentIDChars == REQUEST_TYPE_INDEX){
+
+        MCAL_SPI_SendData(&Glob_u8RequestType, PollingDisable);
+
+    }else if(Glob_u8SentIDChars == REQUEST_VERSION_INDEX){
+
+        /*Report the cache version so the admin ECU sends the missing updates*/
+        MCAL_SPI_SendData((uint8_t *)&Glob_u8AuthCacheVersion, PollingDisable);
+    }else{
+        MCAL_SPI_SendData(&Glob_au8DriverID[Glob_u8SentIDChars - (REQUEST_VERSION_INDEX + 1u)], PollingDisable);
+    }
+            
+    Glob_u8SentIDChars++;
+
+    if(Glob_u8SentIDChars == REQUEST_FRAME_SIZE)
+    {
+        Glob_u8SentIDChars = 0;
+
+        /*The admin ECU took the whole frame so it's reachable again*/
+        Glob_boolAdminOffline = FALSE;
+        
+        if(REQUEST_AUTHENTICATE == Glob_u8RequestType)
+        {
+            Glob_u8ModuleCurrentState = UAI_WAITING_AUTHENTICATION_RESULT;
+            
+            /*Restart the deadline to prevent getting stuck in this state forever*/
+            Glob_u32AuthDeadlineMs = MCAL_TIMER1_Millis() + UAI_RequestTimeout();
+        }else{
+            /*The request is answered by taking the frame*/
+            UAI_SampleRoundTrip();
+
+            if(REQUEST_OFFLINE_ENTRY == Glob_u8RequestType)
+            {
+                Glob_boolJournalRecordSent = TRUE;
+            }else{
+
+            }
+
+            /*No answer is expected*/
+            Glob_u8ModuleCurrentState = UAI_IDLE;
+        }
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_FindCachedID
+* @brief		:   This function looks for a driver's ID in the authorization cache.
+* @param [in]	:   copy_pu8DriverID: The driver's ID.
+* @return       :   uint8_t: Index of the ID in the cache, AUTH_CACHE_SIZE if it's not cached.
+======================================================================================================================
+*/
+static uint8_t UAI_FindCachedID(const uint8_t* copy_pu8DriverID)
+{
+    uint8_t LOC_u8Found = AUTH_CACHE_SIZE;
+    uint8_t LOC_u8Entry;
+    uint8_t LOC_u8Index;
+
+    for(LOC_u8Entry = 0; (LOC_u8Entry < Glob_u8AuthCacheCount) && (AUTH_CACHE_SIZE == LOC_u8Found); LOC_u8Entry++)
+    {
+        LOC_u8Index = 0;
+
+        while((LOC_u8Index < DRIVER_ID_SIZE) && (Glob_au8AuthCache[LOC_u8Entry][LOC_u8Index] == copy_pu8DriverID[LOC_u8Index]))
+        {
+            LOC_u8Index++;
+        }
+
+        if(LOC_u8Index == DRIVER_ID_SIZE)
+        {
+            LOC_u8Found = LOC_u8Entry;
+        }else{
+
+        }
+    }
+
+    return LOC_u8Found;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_ApplyCacheUpdate
+* @brief		:   This function applies a complete cache update frame to the authorization cache.
+* @note			:   An update that doesn't follow the cache version is ignored, the admin ECU learns the
+*               :   actual version from the next request and sends what is missing.
+======================================================================================================================
+*/
+static void UAI_ApplyCacheUpdate(void)
+{
+    uint8_t LOC_u8Version = Glob_au8CacheFrame[AUTH_CACHE_FRAME_VERSION_INDEX];
+    const uint8_t* LOC_pu8ID = &Glob_au8CacheFrame[AUTH_CACHE_FRAME_ID_INDEX];
+    uint8_t LOC_u8Index;
+    uint8_t LOC_u8Found = UAI_FindCachedID(LOC_pu8ID);
+    uint32_t LOC_u32Now = MCAL_TIMER1_Millis();
+    boolean LOC_boolChanged = FALSE;
+
+    switch(Glob_au8CacheFrame[AUTH_CACHE_FRAME_OP_INDEX])
+    {
+        case AUTH_CACHE_OP_CLEAR:
+            Glob_u8AuthCacheCount = 0;
+            Glob_u8AuthCacheVersion = LOC_u8Version;
+            LOC_boolChanged = TRUE;
+            break;
+
+        case AUTH_CACHE_OP_ADD:
+        case AUTH_CACHE_OP_LOAD:
+            if(((AUTH_CACHE_OP_ADD == Glob_au8CacheFrame[AUTH_CACHE_FRAME_OP_INDEX]) && 
+                (AUTH_CACHE_NEXT_VERSION(Glob_u8AuthCacheVersion) == LOC_u8Version) &&
+                (AUTH_CACHE_VERSION_UNSYNCED != Glob_u8AuthCacheVersion)) ||
+               ((AUTH_CACHE_OP_LOAD == Glob_au8CacheFrame[AUTH_CACHE_FRAME_OP_INDEX]) && 
+                (Glob_u8AuthCacheVersion == LOC_u8Version)))
+            {
+                /*A full cache only holds part of the list, the other IDs are authenticated by the admin ECU*/
+                if((AUTH_CACHE_SIZE == LOC_u8Found) && (Glob_u8AuthCacheCount < AUTH_CACHE_SIZE))
+                {
+                    for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+                    {
+                        Glob_au8AuthCache[Glob_u8AuthCacheCount][LOC_u8Index] = LOC_pu8ID[LOC_u8Index];
+                    }
+
+                    Glob_u8AuthCacheCount++;
+                    LOC_boolChanged = TRUE;
+                }else{
+
+                }
+
+                Glob_u8AuthCacheVersion = LOC_u8Version;
+            }else{
+
+            }
+            break;
+
+        case AUTH_CACHE_OP_REMOVE:
+            if((AUTH_CACHE_NEXT_VERSION(Glob_u8AuthCacheVersion) == LOC_u8Version) &&
+               (AUTH_CACHE_VERSION_UNSYNCED != Glob_u8AuthCacheVersion))
+            {
+                /*Move the last entry into the place of the removed one*/
+                if(AUTH_CACHE_SIZE != LOC_u8Found)
+                {
+                    Glob_u8AuthCacheCount--;
+
+                    for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+                    {
+                        Glob_au8AuthCache[LOC_u8Found][LOC_u8Index] = Glob_au8AuthCache[Glob_u8AuthCacheCount][LOC_u8Index];
+                    }
+
+                    LOC_boolChanged = TRUE;
+                }else{
+
+                }
+
+                Glob_u8AuthCacheVersion = LOC_u8Version;
+            }else{
+
+            }
+            break;
+
+        case AUTH_CACHE_OP_OCCUPANCY:
+            if(Glob_boolGarageFull != ((0u == LOC_pu8ID[0])? TRUE : FALSE))
+            {
+                Glob_boolGarageFull = (0u == LOC_pu8ID[0])? TRUE : FALSE;
+                Glob_boolOccupancyChanged = TRUE;
+            }else{
+
+            }
+            break;
+
+        default: /*AUTH_CACHE_OP_SYNC*/
+            break;
+    }
+
+    /*The cache is confirmed to match the admin ECU list*/
+    if((LOC_u8Version == Glob_u8AuthCacheVersion) && (AUTH_CACHE_VERSION_UNSYNCED != Glob_u8AuthCacheVersion))
+    {
+        Glob_u32AuthCacheExpiryMs = LOC_u32Now + AUTH_CACHE_MAX_AGE_MS;
+        Glob_u32AuthCacheNextSyncMs = LOC_u32Now + AUTH_CACHE_REFRESH_MS;
+    }else{
+
+    }
+
+    /*Rewrite the EEPROM snapshot once the cache stops changing*/
+    if(TRUE == LOC_boolChanged)
+    {
+        Glob_boolSnapshotDirty = TRUE;
+        Glob_u32CacheChangeMs = LOC_u32Now;
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   SPI_ReceivingCacheUpdate
+* @brief		:   This function receives a cache update frame from the admin ECU.
+* @param [in]	:   copy_u8RxByte: The byte received from the admin ECU.
+* @note			:   The admin ECU repeats the start byte until this gate answers with its address.
+======================================================================================================================
+*/
+static void SPI_ReceivingCacheUpdate(uint8_t copy_u8RxByte)
+{
+    uint8_t LOC_u8TxByte;
+
+    if((AUTH_CACHE_FRAME_START_BYTE == copy_u8RxByte) && (0u == Glob_u8CacheFrameIndex))
+    {
+        Glob_boolCacheFrameStarted = TRUE;
+        Glob_u32CacheFrameStartMs = MCAL_TIMER1_Millis();
+
+        /*Answer with the gate address to let the admin ECU send the update*/
+        MCAL_SPI_SendData((uint8_t *)&Glob_u8GateAddress, PollingDisable);
+    }else{
+        Glob_au8CacheFrame[Glob_u8CacheFrameIndex] = copy_u8RxByte;
+        Glob_u8CacheFrameIndex++;
+
+        if(AUTH_CACHE_FRAME_SIZE == Glob_u8CacheFrameIndex)
+        {
+            Glob_u8CacheFrameIndex = 0;
+            Glob_boolCacheFrameStarted = FALSE;
+            Glob_boolAdminOffline = FALSE;
+
+            UAI_ApplyCacheUpdate();
+
+            /*Write zero in the transmit buffer to avoid confusion in the next time*/
+            LOC_u8TxByte = 0x00u;
+            MCAL_SPI_SendData(&LOC_u8TxByte, PollingDisable);
+        }else{
+
+        }
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_IsCachedDriverID
+* @brief		:   This function checks if the current driver's ID is in an up to date authorization cache.
+* @param [in]	:   copy_boolOffline: TRUE to trust the cache whatever its age, while the admin ECU is unreachable
+*               :   it's the last list known to this gate.
+* @return       :   boolean: TRUE if the gate can open without asking the admin ECU.
+======================================================================================================================
+*/
+static boolean UAI_IsCachedDriverID(boolean copy_boolOffline)
+{
+    boolean LOC_boolFound = FALSE;
+    uint8_t LOC_u8SREG;
+
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    if(((TRUE == copy_boolOffline) || ((AUTH_CACHE_VERSION_UNSYNCED != Glob_u8AuthCacheVersion) &&
+                                       !TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32AuthCacheExpiryMs))) &&
+       (AUTH_CACHE_SIZE != UAI_FindCachedID(Glob_au8DriverID)))
+    {
+        LOC_boolFound = TRUE;
+    }else{
+
+    }
+
+    SREG = LOC_u8SREG;
+
+    return LOC_boolFound;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_IsAuthenticating
+* @brief		:   This function checks if a driver's ID is being authenticated by the admin ECU.
+* @return       :   boolean: TRUE until the authentication result is taken.
+* @note			:   Notifications and cache syncs are sent in the background and don't count.
+======================================================================================================================
+*/
+static boolean UAI_IsAuthenticating(void)
+{
+    return ((UAI_IDLE != Glob_u8ModuleCurrentState) && (REQUEST_AUTHENTICATE == Glob_u8RequestType))? TRUE : FALSE;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_StartRequest
+* @brief		:   This function asks the admin ECU for attention to send it a request frame.
+* @param [in]	:   copy_u8RequestType: Must be a value of @ref REQUEST_FRAME.
+======================================================================================================================
+*/
+static void UAI_StartRequest(uint8_t copy_u8RequestType)
+{
+    uint8_t LOC_u8SREG;
+
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    Glob_u8RequestType = copy_u8RequestType;
+    Glob_u8SentIDChars = 0;
+    Glob_boolDetectedGateAddress = FALSE;
+
+    Glob_u8RequestRetries = 0;
+    Glob_boolRequestSampled = FALSE;
+    Glob_boolResultDetailValid = FALSE;
+    Glob_u32RequestStartMs = MCAL_TIMER1_Millis();
+    Glob_u32AuthDeadlineMs = Glob_u32RequestStartMs + UAI_RequestTimeout();
+
+    /*Set the current state of the module*/
+    Glob_u8ModuleCurrentState = UAI_SENDING_ID;
+
+    SREG = LOC_u8SREG;
+
+    /*Toggle the ADMIN_ECU_INTERRUPT_PIN to alert the admin that we need attention*/
+    MCAL_GPIO_FastTogglePin(ADMIN_ECU_INTERRUPT_PORT, ADMIN_ECU_INTERRUPT_PIN);
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_RetryRequest
+* @brief		:   This function gives the admin ECU another try to answer the current request.
+* @note			:   Called with the interrupts disabled. A frame the admin ECU didn't take is sent again, a frame
+*               :   it took is only waited for longer as sending it again would authenticate the driver twice.
+======================================================================================================================
+*/
+static void UAI_RetryRequest(void)
+{
+    Glob_u8RequestRetries++;
+    Glob_u32AuthDeadlineMs = MCAL_TIMER1_Millis() + UAI_RequestTimeout();
+
+    if(UAI_SENDING_ID == Glob_u8ModuleCurrentState)
+    {
+        Glob_u8SentIDChars = 0;
+        Glob_boolDetectedGateAddress = FALSE;
+
+        MCAL_GPIO_FastTogglePin(ADMIN_ECU_INTERRUPT_PORT, ADMIN_ECU_INTERRUPT_PIN);
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_LoadOfflineStore
+* @brief		:   This function loads the allow-list snapshot into the authorization cache and the journal indices.
+* @note			:   Called before the SPI interrupt is enabled, the cache stays unsynced until the admin ECU 
+*               :   confirms it so it's only trusted while offline.
+======================================================================================================================
+*/
+static void UAI_LoadOfflineStore(void)
+{
+    uint8_t LOC_au8Snapshot[SNAPSHOT_SIZE];
+    uint8_t LOC_au8JournalIndex[JOURNAL_INDEX_SIZE];
+    uint8_t* LOC_pu8Cache = &Glob_au8AuthCache[0][0];
+    uint8_t LOC_u8Index;
+
+    if((E_OK == MCAL_EEPROM_ReadRecord(&Glob_sSnapshotRecord, LOC_au8Snapshot)) &&
+       (AUTH_CACHE_SIZE >= LOC_au8Snapshot[SNAPSHOT_COUNT_INDEX]))
+    {
+        for(LOC_u8Index = 0; LOC_u8Index < (LOC_au8Snapshot[SNAPSHOT_COUNT_INDEX] * DRIVER_ID_SIZE); LOC_u8Index++)
+        {
+            LOC_pu8Cache[LOC_u8Index] = LOC_au8Snapshot[SNAPSHOT_IDS_OFFSET + LOC_u8Index];
+        }
+
+        Glob_u8AuthCacheCount = LOC_au8Snapshot[SNAPSHOT_COUNT_INDEX];
+    }else{
+
+    }
+
+    /*A journal that was never written or is corrupted starts empty*/
+    if((E_OK == MCAL_EEPROM_ReadRecord(&Glob_sJournalIndexRecord, LOC_au8JournalIndex)) &&
+       ((uint8_t)(LOC_au8JournalIndex[JOURNAL_INDEX_HEAD] - LOC_au8JournalIndex[JOURNAL_INDEX_TAIL]) <= JOURNAL_SIZE))
+    {
+        Glob_u8JournalHead = LOC_au8JournalIndex[JOURNAL_INDEX_HEAD];
+        Glob_u8JournalTail = LOC_au8JournalIndex[JOURNAL_INDEX_TAIL];
+    }else{
+        Glob_u8JournalHead = 0;
+        Glob_u8JournalTail = 0;
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_SaveSnapshot
+* @brief		:   This function queues the authorization cache to be written to the EEPROM snapshot.
+* @note			:   The snapshot stays dirty to be retried if the EEPROM write queue is full.
+======================================================================================================================
+*/
+static void UAI_SaveSnapshot(void)
+{
+    uint8_t LOC_au8Snapshot[SNAPSHOT_SIZE];
+    const uint8_t* LOC_pu8Cache = &Glob_au8AuthCache[0][0];
+    uint8_t LOC_u8Index;
+    uint8_t LOC_u8SREG;
+
+    /*Take a consistent copy, the SPI ISR may update the cache*/
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    LOC_au8Snapshot[SNAPSHOT_COUNT_INDEX] = Glob_u8AuthCacheCount;
+
+    /*The unused entries are saved too, the record has a fixed size*/
+    for(LOC_u8Index = 0; LOC_u8Index < (AUTH_CACHE_SIZE * DRIVER_ID_SIZE); LOC_u8Index++)
+    {
+        LOC_au8Snapshot[SNAPSHOT_IDS_OFFSET + LOC_u8Index] = LOC_pu8Cache[LOC_u8Index];
+    }
+
+    SREG = LOC_u8SREG;
+
+    if(E_OK != MCAL_EEPROM_WriteRecord(&Glob_sSnapshotRecord, LOC_au8Snapshot))
+    {
+        Glob_boolSnapshotDirty = TRUE;
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_SaveJournalIndex
+* @brief		:   This function queues the journal indices to be written to the EEPROM.
+* @return       :   eStatus_t: E_NOK if the EEPROM write queue is full.
+======================================================================================================================
+*/
+static eStatus_t UAI_SaveJournalIndex(void)
+{
+    uint8_t LOC_au8JournalIndex[JOURNAL_INDEX_SIZE];
+
+    LOC_au8JournalIndex[JOURNAL_INDEX_HEAD] = Glob_u8JournalHead;
+    LOC_au8JournalIndex[JOURNAL_INDEX_TAIL] = Glob_u8JournalTail;
+
+    return MCAL_EEPROM_WriteRecord(&Glob_sJournalIndexRecord, LOC_au8JournalIndex);
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_JournalEntry
+* @brief		:   This function journals the current driver's ID as a vehicle the admin ECU wasn't told about.
+* @note			:   A full journal keeps its oldest records and drops the new one.
+======================================================================================================================
+*/
+static void UAI_JournalEntry(void)
+{
+    if(((uint8_t)(Glob_u8JournalHead - Glob_u8JournalTail) < JOURNAL_SIZE) &&
+       (E_OK == MCAL_EEPROM_Write(JOURNAL_RECORDS_EEPROM_ADDRESS + ((Glob_u8JournalHead & JOURNAL_MASK) * DRIVER_ID_SIZE),
+                                  Glob_au8DriverID, DRIVER_ID_SIZE)))
+    {
+        /*Publish the record after it, the EEPROM writes are done in order*/
+        Glob_u8JournalHead++;
+
+        if(E_OK != UAI_SaveJournalIndex())
+        {
+            Glob_u8JournalHead--;
+        }else{
+
+        }
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_JournalReplayNext
+* @brief		:   This function sends the oldest journal record to the admin ECU.
+* @note			:   The record stays in the journal until its frame is sent.
+======================================================================================================================
+*/
+static void UAI_JournalReplayNext(void)
+{
+    MCAL_EEPROM_Read(JOURNAL_RECORDS_EEPROM_ADDRESS + ((Glob_u8JournalTail & JOURNAL_MASK) * DRIVER_ID_SIZE),
+                          Glob_au8DriverID, DRIVER_ID_SIZE);
+
+    UAI_StartRequest(REQUEST_OFFLINE_ENTRY);
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   UAI_JournalDropRecord
+* @brief		:   This function removes the oldest journal record once the admin ECU took it.
+* @note			:   It's retried in the next pass if the EEPROM write queue is full.
+======================================================================================================================
+*/
+static void UAI_JournalDropRecord(void)
 {
-    static uint8_t sLOC_u8CharCounter = 0;
-
-    /*Get the character the user typed*/
-    MCAL_UART_Get_Data((uint16_t *)(&Glob_u8DriverID[sLOC_u8CharCounter]), USART_PollingDisabled);
-
-    /*Send the character again to show it on the terminal*/
-    MCAL_UART_Send_Data((uint16_t *)(&Glob_u8DriverID[sLOC_u8CharCounter]), USART_PollingDisabled);
-        
-    sLOC_u8CharCounter++;
+    Glob_u8JournalTail++;
 
-    if(sLOC_u8CharCounter == DRIVER_ID_SIZE)
+    if(E_OK != UAI_SaveJournalIndex())
     {
-        /*Add a NULL character at the end*/
-        Glob_u8DriverID[sLOC_u8CharCounter] = '\0';
-
-        sLOC_u8CharCounter = 0;
- 
-        /*Disable the UART to stop it from serving another customer 
-          until processing this customer's request*/
-        MCAL_UART_Disable();
-
-        fptr_st_UserAdminInterface = st_UAI_SendIDToAdmin;
+        Glob_u8JournalTail--;
+        Glob_boolJournalRecordSent = TRUE;
     }else{
 
     }
@@ -134,83 +1066,137 @@ static void USART_RX_ISR_Callback(void)
 
 /**
 ======================================================================================================================
-* @Func_name	:   SPI_SendingID
-* @brief		:   Function to send the driver's ID to the admin through SPI interface.
-* @note			:   none.
+* @Func_name	:   UAI_HandleReply
+* @brief		:   This function handles an answer of the admin ECU to the authentication request.
+* @param [in]	:   copy_u8Code: Must be a value of @ref AUTHENTICATION_RESULT or @ref ADMIN_REPLY.
+* @param [in]	:   copy_u8Argument: The argument of a reply or the slots left after a result.
+* @param [in]	:   copy_u8Detail: The detail of a result, @ref RESULT_DETAIL.
+* @note			:   Called from the SPI ISR. A waiting driver only takes its admission and an admission is only
+*               :   taken while waiting, a late one is never taken as the answer of another request.
 ======================================================================================================================
 */
-static void SPI_SendingID(void)
+static void UAI_HandleReply(uint8_t copy_u8Code, uint8_t copy_u8Argument, uint8_t copy_u8Detail)
 {
-    static uint8_t sLOC_u8CharCounter = 0;
+    boolean LOC_boolExpected;
+
+    LOC_boolExpected = ((ADMIN_REPLY_ADMITTED == copy_u8Code) == (UAI_WAITLISTED == Glob_u8ModuleCurrentState))? TRUE : FALSE;
 
-    if(sLOC_u8CharCounter == 0)
+    if(TRUE == LOC_boolExpected)
     {
-        MCAL_SPI_SendData((uint8_t *)&Glob_u8GateAddress, PollingDisable);
+        UAI_SampleRoundTrip();
     }else{
-        MCAL_SPI_SendData(&Glob_u8DriverID[sLOC_u8CharCounter - 1], PollingDisable);
+
     }
-            
-    sLOC_u8CharCounter++;
 
-    if(sLOC_u8CharCounter == (DRIVER_ID_SIZE + 1))
+    if(FALSE == LOC_boolExpected)
     {
-        MCAL_TIMER0_Stop();
+        /*Ignore it, the admin ECU sends the admission again while the driver waits*/
 
-        sLOC_u8CharCounter = 0;
-        
-        Glob_u8ModuleCurrentState = UAI_WAITING_AUTHENTICATION_RESULT;
-        
-        /*Enable the timer to prevent getting stuck in this state forever*/
-        MCAL_TIMER0_SingleIntervalDelayms(TIME_BEFORE_RESET_MS, Timer0_SingleIntervalDelaycallback);
+    }else if(ADMIN_REPLY_ADMITTED == copy_u8Code){
+
+        /*Open for the waiting driver, the admin ECU keeps the slot until it's notified*/
+        Glob_u8ModuleCurrentState = UAI_AUTHENTICATION_DONE;
+        Glob_boolWaitMsgPending = FALSE;
+
+        Glob_u8ResultSlots = copy_u8Argument;
+        Glob_u8ResultDetail = copy_u8Detail;
+
+        fptr_st_UserAdminInterface = st_UAI_AdmittedFromWaitlist;
+
+    }else if(ADMIN_REPLY_ACCEPTED == copy_u8Code){
+
+        /*Wait for the requests ahead of this one to be served*/
+        Glob_u8QueuePosition = copy_u8Argument;
+        Glob_u32AuthDeadlineMs = MCAL_TIMER1_Millis() + UAI_RequestTimeout() + 
+                                 ((uint32_t)copy_u8Argument * REQUEST_SERVICE_TIME_MS);
+        Glob_boolWaitMsgPending = TRUE;
+
+    }else if(ADMIN_REPLY_BUSY == copy_u8Code){
+
+        /*The request was dropped, send it again once the admin ECU has room for it*/
+        Glob_u8ModuleCurrentState = UAI_RETRY_SCHEDULED;
+        Glob_u8QueuePosition = 0;
+        Glob_u32AuthDeadlineMs = MCAL_TIMER1_Millis() + ((uint32_t)copy_u8Argument * ADMIN_REPLY_RETRY_UNIT_MS);
+        Glob_boolWaitMsgPending = TRUE;
+
+    }else if(ADMIN_REPLY_WAITLISTED == copy_u8Code){
+
+        /*The ID is valid, the admin ECU sends the admission once a slot frees up*/
+        Glob_u8ModuleCurrentState = UAI_WAITLISTED;
+        Glob_u8QueuePosition = copy_u8Argument;
+        Glob_u32AuthDeadlineMs = MCAL_TIMER1_Millis() + REQUEST_WAITLIST_TIMEOUT_MS;
+        Glob_boolWaitMsgPending = TRUE;
 
-        fptr_st_UserAdminInterface = st_UAI_Idle;
     }else{
+        /*The request is answered, the deadline doesn't apply anymore*/
+        Glob_u8ModuleCurrentState = UAI_AUTHENTICATION_DONE;
+        Glob_boolWaitMsgPending = FALSE;
+
+        Glob_u8ResultSlots = copy_u8Argument;
+        Glob_u8ResultDetail = copy_u8Detail;
+        Glob_boolResultDetailValid = TRUE;
+
+        /*check if the data we got matches the successful authentication code*/
+        if(copy_u8Code == AUTHENTICATION_RESULT_PASS)
+        {
+            fptr_st_UserAdminInterface = st_UAI_IDAuthenticationPassed;
 
+        }else if(RESULT_REASON_GARAGE_FULL == RESULT_DETAIL_REASON(copy_u8Detail)){
+
+            /*Only the occupancy push sets the garage full, the admin ECU clears it the same way*/
+            fptr_st_UserAdminInterface = st_UAI_GarageFull;
+        }else{
+            fptr_st_UserAdminInterface = st_UAI_IDAuthenticationFailed;
+        }
     }
 }
 
 /**
 ======================================================================================================================
 * @Func_name	:   SPI_GetAuthenticationResult
-* @brief		:   This function checks the authentication process result.
+* @brief		:   This function receives the answers of the admin ECU to the authentication request.
+* @param [in]	:   copy_u8RxByte: The byte received by the SPI interrupt.
+* @note			:   The admin ECU repeats the gate address until it reads it back, the answer frame follows.
 ======================================================================================================================
 */
-void SPI_GetAuthenticationResult(void)
+static void SPI_GetAuthenticationResult(uint8_t copy_u8RxByte)
 {
-    static boolean LOC_boolDetectedGateAddress = FALSE;
-    uint8_t LOC_u8RxBuffer = ENTRANCE_GATE_ECU_ADDRESS;
+    uint8_t LOC_u8TxByte;
 
-    MCAL_SPI_ReceiveData(&LOC_u8RxBuffer, PollingEnable);
-
-    /*If we already received the gate ID from the last transmission 
-      then check the authentication result*/
-    if(LOC_boolDetectedGateAddress)
-    { 
-        /*Stop the timer as we are already done from this state*/
-        MCAL_TIMER0_Stop();
-
-        LOC_boolDetectedGateAddress = FALSE;
-
-        /*check if the data we got matches the successful authentication code*/
-        if(LOC_u8RxBuffer == AUTHENTICATION_RESULT_PASS)
+    if(FALSE == Glob_boolDetectedGateAddress)
+    {
+        /*check if the received data matches the the gate address*/
+        if(copy_u8RxByte == Glob_u8GateAddress)
         {
-            fptr_st_UserAdminInterface = st_UAI_IDAuthenticationPassed;
+            /*Echo the address so the admin ECU sends the frame*/
+            MCAL_SPI_SendData((uint8_t *)&Glob_u8GateAddress, PollingDisable);
+
+            Glob_boolDetectedGateAddress = TRUE;
+            Glob_u8ReplyIndex = 0;
         }else{
-            fptr_st_UserAdminInterface = st_UAI_IDAuthenticationFailed;
+
         }
 
-        LOC_u8RxBuffer = 0x00u;
-        
-        /*Write zero in the transmit buffer to avoid confusion in the next time*/
-        MCAL_SPI_SendData(&LOC_u8RxBuffer, PollingDisable);
+    }else if((0u == Glob_u8ReplyIndex) && (copy_u8RxByte == Glob_u8GateAddress)){
+
+        /*The admin ECU is still syncing, the answer codes never match a gate address*/
+        MCAL_SPI_SendData((uint8_t *)&Glob_u8GateAddress, PollingDisable);
 
     }else{
+        Glob_au8ReplyFrame[Glob_u8ReplyIndex] = copy_u8RxByte;
+        Glob_u8ReplyIndex++;
 
-        /*check if the received data matches the the gate address*/
-        if(LOC_u8RxBuffer == Glob_u8GateAddress)
+        if(Glob_u8ReplyIndex == ADMIN_REPLY_FRAME_SIZE)
         {
-            MCAL_SPI_SendData(&LOC_u8RxBuffer , PollingEnable);
-            LOC_boolDetectedGateAddress = TRUE;
+            Glob_boolDetectedGateAddress = FALSE;
+            Glob_u8ReplyIndex = 0;
+
+            UAI_HandleReply(Glob_au8ReplyFrame[ADMIN_REPLY_CODE_INDEX], Glob_au8ReplyFrame[ADMIN_REPLY_ARGUMENT_INDEX],
+                            Glob_au8ReplyFrame[ADMIN_REPLY_DETAIL_INDEX]);
+
+            /*Write zero in the transmit buffer to avoid confusion in the next time*/
+            LOC_u8TxByte = 0x00u;
+            MCAL_SPI_SendData(&LOC_u8TxByte, PollingDisable);
         }else{
 
         }
@@ -226,24 +1212,57 @@ void SPI_GetAuthenticationResult(void)
 */
 static void SPI_ISR_Callback(void)
 {
-    switch (Glob_u8ModuleCurrentState)
+    uint8_t LOC_u8RxByte;
+
+    MCAL_SPI_ReceiveData(&LOC_u8RxByte, PollingDisable);
+
+    /*Drop a cache update frame the admin ECU stopped sending*/
+    if((TRUE == Glob_boolCacheFrameStarted) && 
+       TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32CacheFrameStartMs + AUTH_CACHE_FRAME_TIMEOUT_MS))
     {
-    case UAI_IDLE:
-        /* If we didn't send a request just ignore this interrupt as it's probably
-           done to communicate with the other gate ECU. (Can be changed later if needed)*/
-        break;
+        Glob_boolCacheFrameStarted = FALSE;
+        Glob_u8CacheFrameIndex = 0;
+    }else{
 
-    case UAI_SENDING_ID:
-        SPI_SendingID();
-        break;
+    }
 
-    case UAI_WAITING_AUTHENTICATION_RESULT:
-        SPI_GetAuthenticationResult();
-        break;
+    /*Cache updates may come in any state as long as no request frame is in progress*/
+    if((TRUE == Glob_boolCacheFrameStarted) || 
+       ((AUTH_CACHE_FRAME_START_BYTE == LOC_u8RxByte) && (0u == Glob_u8SentIDChars) && (FALSE == Glob_boolDetectedGateAddress)))
+    {
+        SPI_ReceivingCacheUpdate(LOC_u8RxByte);
+    }else{
+        switch (Glob_u8ModuleCurrentState)
+        {
+        case UAI_IDLE:
+            /* If we didn't send a request just ignore this interrupt as it's probably
+               done to communicate with the other gate ECU. (Can be changed later if needed)*/
+            break;
+
+        case UAI_SENDING_ID:
+            SPI_SendingID();
+            break;
+
+        case UAI_WAITING_AUTHENTICATION_RESULT:
+            SPI_GetAuthenticationResult(LOC_u8RxByte);
+            break;
+
+        case UAI_AUTHENTICATION_DONE:
+            /*The result was taken, ignore the rest of the exchange*/
+            break;
+
+        case UAI_RETRY_SCHEDULED:
+            /*The request was dropped, nothing is expected until it's sent again*/
+            break;
+
+        case UAI_WAITLISTED:
+            SPI_GetAuthenticationResult(LOC_u8RxByte);
+            break;
     
-    default:
-        break;
-    }   
+        default:
+            break;
+        }
+    }
 }
 /**
   * @}
@@ -253,12 +1272,33 @@ static void SPI_ISR_Callback(void)
 /** @defgroup Private Functions
   * @{
   */
+
+/**
+ * @brief This function enables the UART to take the next card, a reader that is already 
+ *  enabled keeps the frame it's receiving.
+ * 
+ */
+static void UAI_EnableCardReader(void)
+{
+    if(FALSE == Glob_boolCardReaderEnabled)
+    {
+        /*Drop any partial frame received before the UART was disabled*/
+        HAL_RFID_Reset();
+
+        Glob_boolCardReaderEnabled = TRUE;
+
+        MCAL_UART_Enable();
+    }else{
+
+    }
+}
+
 static void USART_Init()
 {
     sUSART_config_t cfg;
 
     cfg.USART_CLKOperation = USART_CLKOP_NormalAsynch;
-    cfg.USART_baudRate = USART_BAUD_RATE_9600;
+    cfg.USART_baudRate = USART_BAUD_CONFIG(USART_BAUD_RATE_9600);
     cfg.USART_Mode = USART_ModeTXRX;
     cfg.USART_wordLength = USART_8BitWord;
     cfg.USART_parityCTRL = USART_ParityMode_Disabled;
@@ -309,6 +1349,9 @@ static void SPI_Init()
  */
 void st_UAI_Init(void)
 {
+    /*Load the allow-list snapshot and the journal before the admin ECU can update the cache*/
+    UAI_LoadOfflineStore();
+
     /*Initialize the USART module to get the input from the user*/
     USART_Init();
 
@@ -330,18 +1373,25 @@ void st_UAI_Init(void)
  */
 void st_UAI_ShowWelcomeMsg(void)
 {
-    Glob_u8ModuleCurrentState = UAI_IDLE; 
-
     LCD_Clear_Screen();
 
-    LCD_Cursor_XY(LCD_FIRST_LINE, 4);
-    LCD_Send_String(stringfy("Welcome!"));
+    if(TRUE == Glob_boolGarageFull)
+    {
+        LCD_Cursor_XY(LCD_FIRST_LINE, 4);
+        LCD_Send_String(stringfy("Garage FULL!"));
 
-    LCD_Cursor_XY(LCD_THIRD_LINE, 0);
-    LCD_Send_String(stringfy("Please enter the 3 digits ID"));
+        LCD_Cursor_XY(LCD_THIRD_LINE, 0);
+        LCD_Send_String(stringfy("No free slots"));
+    }else{
+        LCD_Cursor_XY(LCD_FIRST_LINE, 4);
+        LCD_Send_String(stringfy("Welcome!"));
+
+        LCD_Cursor_XY(LCD_THIRD_LINE, 0);
+        LCD_Send_String(stringfy("Please scan your card"));
+    }
 
     /*Enable the UART module to take the user input*/
-    MCAL_UART_Enable();
+    UAI_EnableCardReader();
 
     fptr_st_UserAdminInterface = st_UAI_Idle;
 }
@@ -350,38 +1400,266 @@ void st_UAI_ShowWelcomeMsg(void)
 /**
  * @brief this state makes the module go into idle mode until some user action is done.
  * 
+ * @note It starts the authentication of the next queued card once the module is free, retries then drops 
+ * a request the admin ECU didn't answer in time and asks for a cache sync before the cache expires.
+ * A request the admin ECU was too busy to queue is sent again after the delay it asked for.
+ * It also keeps the EEPROM snapshot up to date and replays the journal once the admin ECU answers again.
  */
 void st_UAI_Idle(void)
 {
+    uint8_t LOC_u8SREG;
+    uint8_t LOC_u8Action = IDLE_ACTION_NONE;
+
+    /*The admin ECU took the replayed record*/
+    if(TRUE == Glob_boolJournalRecordSent)
+    {
+        Glob_boolJournalRecordSent = FALSE;
+
+        UAI_JournalDropRecord();
+    }else{
+
+    }
+
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    if(((UAI_SENDING_ID == Glob_u8ModuleCurrentState) || (UAI_WAITING_AUTHENTICATION_RESULT == Glob_u8ModuleCurrentState)) &&
+       TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32AuthDeadlineMs) && (Glob_u8RequestRetries < REQUEST_MAX_RETRIES))
+    {
+        UAI_RetryRequest();
+
+    }else if(((UAI_SENDING_ID == Glob_u8ModuleCurrentState) || (UAI_WAITING_AUTHENTICATION_RESULT == Glob_u8ModuleCurrentState)) &&
+             TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32AuthDeadlineMs)){
+
+        /*The admin ECU didn't answer, reset to serve the next driver from the snapshot until it answers again*/
+        Glob_u8ModuleCurrentState = UAI_IDLE;
+        Glob_boolAdminOffline = TRUE;
+
+        if(REQUEST_AUTHENTICATE == Glob_u8RequestType)
+        {
+            fptr_st_UserAdminInterface = st_UAI_OfflineAuthentication;
+
+        }else if(REQUEST_ENTRY_NOTIFY == Glob_u8RequestType){
+
+            /*The vehicle already passed, keep it for the admin ECU*/
+            LOC_u8Action = IDLE_ACTION_JOURNAL_ENTRY;
+        }else{
+
+        }
+
+    }else if((UAI_RETRY_SCHEDULED == Glob_u8ModuleCurrentState) && 
+             TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32AuthDeadlineMs)){
+
+        UAI_StartRequest(Glob_u8RequestType);
+
+    }else if((UAI_WAITLISTED == Glob_u8ModuleCurrentState) && 
+             TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32AuthDeadlineMs)){
+
+        /*No slot freed up in time, let the next driver try*/
+        Glob_u8ModuleCurrentState = UAI_IDLE;
+
+        fptr_st_UserAdminInterface = st_UAI_GarageFull;
+
+    }else if(TRUE == Glob_boolWaitMsgPending){
+
+        Glob_boolWaitMsgPending = FALSE;
+
+        fptr_st_UserAdminInterface = st_UAI_ShowWaitMsg;
+
+    }else if((UAI_IDLE == Glob_u8ModuleCurrentState) && (Glob_u8IDAheadHead != Glob_u8IDAheadTail)){
+
+        fptr_st_UserAdminInterface = st_UAI_SendIDToAdmin;
+
+    }else if((UAI_IDLE == Glob_u8ModuleCurrentState) && (TRUE == Glob_boolOccupancyChanged)){
+
+        /*Tell the next drivers if the garage is full before they scan*/
+        Glob_boolOccupancyChanged = FALSE;
+
+        fptr_st_UserAdminInterface = st_UAI_ShowWelcomeMsg;
+
+    }else if((UAI_IDLE == Glob_u8ModuleCurrentState) && (TRUE == Glob_boolSnapshotDirty) &&
+             TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32CacheChangeMs + SNAPSHOT_SAVE_DELAY_MS)){
+
+        Glob_boolSnapshotDirty = FALSE;
+
+        LOC_u8Action = IDLE_ACTION_SAVE_SNAPSHOT;
+
+    }else if((UAI_IDLE == Glob_u8ModuleCurrentState) && (FALSE == Glob_boolAdminOffline) &&
+             (Glob_u8JournalHead != Glob_u8JournalTail) && (FALSE == Glob_boolJournalRecordSent)){
+
+        LOC_u8Action = IDLE_ACTION_REPLAY_JOURNAL;
+
+    }else if((UAI_IDLE == Glob_u8ModuleCurrentState) && 
+             TIMER1_TIME_IS_REACHED(MCAL_TIMER1_Millis(), Glob_u32AuthCacheNextSyncMs)){
+
+        /*Ask the admin ECU to confirm the cache before it expires, retry later if it doesn't*/
+        Glob_u32AuthCacheNextSyncMs = MCAL_TIMER1_Millis() + AUTH_CACHE_REFRESH_MS;
+
+        UAI_StartRequest(REQUEST_CACHE_SYNC);
+    }else{
+
+    }
+
+    SREG = LOC_u8SREG;
+
+    /*The EEPROM writes are queued but a read cache miss waits for the byte being written*/
+    switch(LOC_u8Action)
+    {
+        case IDLE_ACTION_JOURNAL_ENTRY:
+            UAI_JournalEntry();
+            break;
 
+        case IDLE_ACTION_SAVE_SNAPSHOT:
+            UAI_SaveSnapshot();
+            break;
+
+        case IDLE_ACTION_REPLAY_JOURNAL:
+            UAI_JournalReplayNext();
+            break;
+
+        default: /*IDLE_ACTION_NONE*/
+            break;
+    }
 }
 
 /**
  * @brief this state sends the driver's ID to the Admin ECU for authentication. 
  * 
+ * @note An ID found in the up to date authorization cache opens the gate right away, the Admin ECU
+ * is only notified. While the Admin ECU is unreachable the driver is authenticated from the snapshot.
  */
 void st_UAI_SendIDToAdmin(void)
 {    
-    
+    uint8_t LOC_u8Index;
+    const sUAI_CardRead_t* LOC_psCard;
+
+    /*Take the oldest card read*/
+    LOC_psCard = &Glob_asIDAheadQueue[Glob_u8IDAheadTail & ID_AHEAD_QUEUE_MASK];
+
+    for(LOC_u8Index = 0; LOC_u8Index < DRIVER_ID_SIZE; LOC_u8Index++)
+    {
+        Glob_au8DriverID[LOC_u8Index] = LOC_psCard->au8DriverID[LOC_u8Index];
+    }
+
+    Glob_u32CardReadTimeMs = LOC_psCard->u32CardReadTimeMs;
+
+    /*Free the entry for the next card*/
+    Glob_u8IDAheadTail++;
+
+    if(TRUE == Glob_boolGarageFull)
+    {
+        /*Refuse right away, there is no slot to authenticate for*/
+        fptr_st_UserAdminInterface = st_UAI_GarageFull;
+
+    }else if(TRUE == Glob_boolAdminOffline){
+
+        /*Don't keep the driver waiting for another timeout, the sync requests find out when it's back*/
+        fptr_st_UserAdminInterface = st_UAI_OfflineAuthentication;
+
+    }else if(TRUE == UAI_IsCachedDriverID(FALSE)){
+
+        /*Open right away and let the admin ECU know in the background*/
+        UAI_StartRequest(REQUEST_ENTRY_NOTIFY);
+
+        fptr_st_UserAdminInterface = st_UAI_IDAuthenticationPassed;
+
+    }else{
+        LCD_Clear_Screen();
+        LCD_Cursor_XY(LCD_SECOND_LINE, 4);
+        LCD_Send_String(stringfy("Processing!"));
+
+        UAI_StartRequest(REQUEST_AUTHENTICATE);
+
+        fptr_st_UserAdminInterface = st_UAI_Idle;
+    }
+}
+
+/**
+ * @brief This state tells the waiting driver where the request is, queued behind others, waiting
+ * for the Admin ECU to have room for it or waiting for a free slot.
+ * 
+ */
+void st_UAI_ShowWaitMsg(void)
+{
+    uint8_t LOC_u8Position = Glob_u8QueuePosition;
+
     LCD_Clear_Screen();
-    LCD_Cursor_XY(LCD_SECOND_LINE, 4);
-    LCD_Send_String(stringfy("Processing!"));
 
-    /*Set the current state of the module*/
-    Glob_u8ModuleCurrentState = UAI_SENDING_ID;
+    LCD_Cursor_XY(LCD_FIRST_LINE, 4);
+    LCD_Send_String(stringfy("Please wait"));
 
-    MCAL_TIMER0_SingleIntervalDelayms(TIME_BEFORE_RESET_MS, Timer0_SingleIntervalDelaycallback);
+    LCD_Cursor_XY(LCD_THIRD_LINE, 0);
 
-    /*Toggle the ADMIN_ECU_INTERRUPT_PIN to alert the admin that we need attention*/
-    MCAL_GPIO_TogglePin(ADMIN_ECU_INTERRUPT_PORT, ADMIN_ECU_INTERRUPT_PIN);
+    if(UAI_WAITLISTED == Glob_u8ModuleCurrentState)
+    {
+        LCD_Send_String(stringfy("Garage full"));
+
+        LCD_Cursor_XY(LCD_FOURTH_LINE, 0);
+
+        if(LOC_u8Position < 10u)
+        {
+            LCD_Send_String(stringfy("Place in line: "));
+            LCD_Send_Char('0' + LOC_u8Position);
+        }else{
+            LCD_Send_String(stringfy("Place in line: 9+"));
+        }
+
+    }else if(0u == LOC_u8Position)
+    {
+        LCD_Send_String(stringfy("System busy, retrying"));
+
+    }else if(LOC_u8Position < 10u){
+
+        LCD_Send_String(stringfy("Queue position: "));
+        LCD_Send_Char('0' + LOC_u8Position);
+    }else{
+        LCD_Send_String(stringfy("Queue position: 9+"));
+    }
 
     fptr_st_UserAdminInterface = st_UAI_Idle;
 }
 
+/**
+ * @brief This state authenticates the driver from the last allow-list known to this gate while the
+ * Admin ECU is unreachable.
+ * 
+ * @note A driver let in is journaled and replayed to the Admin ECU once it answers again, the other
+ * IDs are refused as they can't be checked.
+ */
+void st_UAI_OfflineAuthentication(void)
+{
+    if(TRUE == UAI_IsCachedDriverID(TRUE))
+    {
+        UAI_JournalEntry();
+
+        fptr_st_UserAdminInterface = st_UAI_IDAuthenticationPassed;
+    }else{
+        fptr_st_UserAdminInterface = st_UAI_IDAuthenticationFailed;
+    }
+}
+
+/**
+ * @brief This state lets the waiting driver in once the Admin ECU has a slot for it.
+ * 
+ * @note The Admin ECU only counts the vehicle and frees the place in its waiting list once the entry
+ * is notified, a notification it doesn't get is journaled like a cache hit.
+ */
+void st_UAI_AdmittedFromWaitlist(void)
+{
+    /*Confirm the admission like a cache hit*/
+    UAI_StartRequest(REQUEST_ENTRY_NOTIFY);
+
+    /*Still show the slots left sent with the admission*/
+    Glob_boolResultDetailValid = TRUE;
+
+    fptr_st_UserAdminInterface = st_UAI_IDAuthenticationPassed;
+}
 
 /**
  * @brief This state sends the open gate request and informs the driver that his ID is valid.
  * 
+ * @note The next card is taken while this car passes, if it's approved before the gate closes 
+ * the gate stays open for it.
  */
 void st_UAI_IDAuthenticationPassed(void)
 {
@@ -391,7 +1669,17 @@ void st_UAI_IDAuthenticationPassed(void)
     /*Send a signal to the gate controller to open the gate*/
     UAI_GC_OpenGateReuest();
 
-    fptr_st_UserAdminInterface = st_UAI_Idle;
+    /*Serve the next driver while this car passes the gate, a cache hit is still notifying the admin ECU*/
+    if(UAI_AUTHENTICATION_DONE == Glob_u8ModuleCurrentState)
+    {
+        Glob_u8ModuleCurrentState = UAI_IDLE;
+    }else{
+
+    }
+
+    UAI_EnableCardReader();
+
+    fptr_st_UserAdminInterface = (TRUE == Glob_boolResultDetailValid)? st_UAI_ShowResultDetail : st_UAI_Idle;
 }
 
 /**
@@ -404,6 +1692,88 @@ void st_UAI_IDAuthenticationFailed(void)
     /*Send a signal to the Alarm_Manager module.*/
     UAI_AM_InvalidID();    
 
+    /*The next queued card can be authenticated while the alarm is on*/
+    Glob_u8ModuleCurrentState = UAI_IDLE;
+
+    fptr_st_UserAdminInterface = (TRUE == Glob_boolResultDetailValid)? st_UAI_ShowResultDetail : st_UAI_Idle;
+}
+
+/**
+ * @brief This state informs the driver that the garage is full without raising the invalid ID alarm.
+ * 
+ */
+void st_UAI_GarageFull(void)
+{
+    LCD_Clear_Screen();
+
+    LCD_Cursor_XY(LCD_SECOND_LINE, 4);
+    LCD_Send_String(stringfy("Garage FULL!"));
+
+    LCD_Cursor_XY(LCD_THIRD_LINE, 0);
+    LCD_Send_String(stringfy("Sorry, no free slots"));
+
+    /*The next queued card is refused the same way until a slot is free*/
+    if(UAI_AUTHENTICATION_DONE == Glob_u8ModuleCurrentState)
+    {
+        Glob_u8ModuleCurrentState = UAI_IDLE;
+    }else{
+
+    }
+
+    UAI_EnableCardReader();
+
+    fptr_st_UserAdminInterface = st_UAI_Idle;
+}
+
+/**
+ * @brief This state shows the slots left, the reason of a refusal and the message sent with the result
+ * under the result the Alarm_Manager shows.
+ * 
+ */
+void st_UAI_ShowResultDetail(void)
+{
+    uint8_t LOC_u8Reason = RESULT_DETAIL_REASON(Glob_u8ResultDetail);
+
+    Glob_boolResultDetailValid = FALSE;
+
+    LCD_Cursor_XY(LCD_THIRD_LINE, 0);
+
+    switch(LOC_u8Reason)
+    {
+        case RESULT_REASON_NOT_AUTHORIZED:
+            LCD_Send_String(stringfy("Not authorized"));
+            break;
+
+        case RESULT_REASON_RATE_LIMITED:
+            LCD_Send_String(stringfy("Too many attempts"));
+            break;
+
+        default: /*RESULT_REASON_NONE*/
+            LCD_Send_String(stringfy("Slots left: "));
+            LCD_Send_Char('0' + ((Glob_u8ResultSlots < 10u)? Glob_u8ResultSlots : 9u));
+            break;
+    }
+
+    LCD_Cursor_XY(LCD_FOURTH_LINE, 0);
+
+    switch(RESULT_DETAIL_MSG(Glob_u8ResultDetail))
+    {
+        case RESULT_MSG_WELCOME:
+            LCD_Send_String(stringfy("Welcome!"));
+            break;
+
+        case RESULT_MSG_GOODBYE:
+            LCD_Send_String(stringfy("Goodbye!"));
+            break;
+
+        case RESULT_MSG_CONTACT_ADMIN:
+            LCD_Send_String(stringfy("Contact the admin"));
+            break;
+
+        default: /*RESULT_MSG_NONE*/
+            break;
+    }
+
     fptr_st_UserAdminInterface = st_UAI_Idle;
 }
 
@@ -419,11 +1789,18 @@ void st_UAI_IDAuthenticationFailed(void)
  */
 void GC_UAI_GateClosed(void)
 {
+  Glob_u32LastServiceTimeMs = TIMER1_TIME_ELAPSED(MCAL_TIMER1_Millis(), Glob_u32CardReadTimeMs);
+
   /*Send a signal to turn off the alarm*/
   UAI_AM_TurnOffAlarmGateClosed();
 
-  /*Return to the original state to serve the next customer*/
-  fptr_st_UserAdminInterface = st_UAI_ShowWelcomeMsg;
+  /*Show the welcome message again unless the next driver's card is being processed*/
+  if(FALSE == UAI_IsAuthenticating())
+  {
+    fptr_st_UserAdminInterface = st_UAI_ShowWelcomeMsg;
+  }else{
+
+  }
 }
 
 /**
@@ -441,9 +1818,31 @@ void GC_UAI_GateClosed(void)
  */
 void AM_UAI_AlarmOff()
 {
- fptr_st_UserAdminInterface = st_UAI_ShowWelcomeMsg;
+  /*Show the welcome message again unless the next driver's card is being processed*/
+  if(FALSE == UAI_IsAuthenticating())
+  {
+    fptr_st_UserAdminInterface = st_UAI_ShowWelcomeMsg;
+  }else{
+
+  }
 }
 
  /**
    * @}
-   */
\ No newline at end of file
+   */
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Definitions
+*===============================================
+*/
+
+/**
+ * @brief This function returns the service time of the last vehicle, from the card read until the gate closed.
+ * 
+ * @return uint32_t : The service time in milliseconds, 0 if no vehicle was served yet.
+ */
+uint32_t UAI_GetLastServiceTimeMs(void)
+{
+    return Glob_u32LastServiceTimeMs;
+}
\ No newline at end of file
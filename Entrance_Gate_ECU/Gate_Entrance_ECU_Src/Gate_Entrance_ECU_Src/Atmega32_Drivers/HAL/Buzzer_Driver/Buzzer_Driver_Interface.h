@@ -54,7 +54,10 @@ void HAL_Buzzer_Init(volatile GPIO_typedef* GPIOx, uint8_t copy_BuzzerPin);
  * @param copy_BuzzerPin  :   The GPIO pin that is connected to the Buzzer.
  * @param copy_BuzzerState :   The new state of the Buzzer must be a value of @ref BUZZER_DEFINE.
  */
-void HAL_Buzzer_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_BuzzerPin, eBuzzerState_t copy_BuzzerState);
+GPIO_FORCE_INLINE void HAL_Buzzer_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_BuzzerPin, eBuzzerState_t copy_BuzzerState)
+{
+    MCAL_GPIO_FastWritePin(GPIOx, copy_BuzzerPin, copy_BuzzerState);
+}
 
 /**
  * @brief This function toggles the current state of the buzzer. 
@@ -62,6 +65,9 @@ void HAL_Buzzer_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_BuzzerPin, e
  * @param GPIOx         :   The GPIO port that is connected to the Buzzer.
  * @param copy_BuzzerPin  :   The GPIO pin that is connected to the Buzzer.
  */
-void HAL_Buzzer_ToggleState(volatile GPIO_typedef* GPIOx, uint8_t copy_BuzzerPin);
+GPIO_FORCE_INLINE void HAL_Buzzer_ToggleState(volatile GPIO_typedef* GPIOx, uint8_t copy_BuzzerPin)
+{
+    MCAL_GPIO_FastTogglePin(GPIOx, copy_BuzzerPin);
+}
 
 #endif /* BUZZER_DRIVER_INTERFACE_H_ */
\ No newline at end of file
@@ -19,6 +19,7 @@
 *===============================================
 */
 #include "../MCAL/GPIO/Atmega32_GPIO.h"
+#include "../../MCAL/EXTI/Atmega32_EXTI.h"
 
 /**
  * @brief This enum has the return status of the PIR sensor readings.
@@ -46,6 +47,16 @@ typedef enum{
  */
 void HAL_PIR_Init(volatile GPIO_typedef* GPIOx, uint8_t copy_PIR_Pin);
 
+/**
+ * @brief This function makes the PIR sensor report every change of its status through an external interrupt.
+ * 
+ * @param copy_eLine : The external interrupt line the PIR sensor is connected to (INT0 or INT1).
+ * @param copy_fptrEdgeCallback : Function called from the ISR on every change, read the new status 
+ *                                with HAL_PIR_ReadStatus.
+ * @return eStatus_t : E_OK if the interrupt was enabled, E_NOK otherwise.
+ */
+eStatus_t HAL_PIR_EnableEdgeInterrupt(enum EXTI_Line copy_eLine, Ptr_Func copy_fptrEdgeCallback);
+
 /**
  * @brief This function reads the status of the PIR sensor.
  * 
@@ -54,6 +65,10 @@ void HAL_PIR_Init(volatile GPIO_typedef* GPIOx, uint8_t copy_PIR_Pin);
  * @return ePIRStatus_t :   PIR_MotionDetected if anything is detected infront of the sensor, 
  *                          PIR_NoMotionDetected otherwise.
  */
-ePIRStatus_t HAL_PIR_ReadStatus(volatile GPIO_typedef* GPIOx, uint8_t copy_PIR_Pin);
+GPIO_FORCE_INLINE ePIRStatus_t HAL_PIR_ReadStatus(volatile GPIO_typedef* GPIOx, uint8_t copy_PIR_Pin)
+{
+    /*Determine the status of the PIR sensor from the pin conected to it*/
+    return (MCAL_GPIO_FastReadPin(GPIOx, copy_PIR_Pin) == GPIO_PIN_HIGH)? PIR_MotionDetected : PIR_NoMotionDetected;
+}
 
 #endif /* PIR_INTERFACE_H_ */
\ No newline at end of file
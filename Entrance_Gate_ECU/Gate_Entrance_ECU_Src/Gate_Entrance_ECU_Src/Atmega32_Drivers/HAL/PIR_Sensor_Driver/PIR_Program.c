@@ -41,23 +41,20 @@ void HAL_PIR_Init(volatile GPIO_typedef* GPIOx, uint8_t copy_PIR_Pin)
 }
 
 /**
- * @brief This function reads the status of the PIR sensor.
+ * @brief This function makes the PIR sensor report every change of its status through an external interrupt.
  * 
- * @param GPIOx : The GPIO port of that is connected to the PIR sensor.
- * @param copy_PIR_Pin : The GPIO pin of that is connected to the PIR sensor.
- * @return ePIRStatus_t :   PIR_MotionDetected if anything is detected infront of the sensor, 
- *                          PIR_NoMotionDetected otherwise.
+ * @param copy_eLine : The external interrupt line the PIR sensor is connected to (INT0 or INT1).
+ * @param copy_fptrEdgeCallback : Function called from the ISR on every change, read the new status 
+ *                                with HAL_PIR_ReadStatus.
+ * @return eStatus_t : E_OK if the interrupt was enabled, E_NOK otherwise.
  */
-ePIRStatus_t HAL_PIR_ReadStatus(volatile GPIO_typedef* GPIOx, uint8_t copy_PIR_Pin)
+eStatus_t HAL_PIR_EnableEdgeInterrupt(enum EXTI_Line copy_eLine, Ptr_Func copy_fptrEdgeCallback)
 {
-    ePIRStatus_t LOC_u8PIRStatus;
-    uint8_t LOC_u8PinStatus;
-    
-    /*Read the value of the pin conected to the sensor*/
-    LOC_u8PinStatus = MCAL_GPIO_ReadPin(GPIOx, copy_PIR_Pin);
+    sEXTI_Config_t LOC_sEXTICfg;
 
-    /*Determine the status of the PIR sensor*/
-    LOC_u8PIRStatus = (LOC_u8PinStatus == GPIO_PIN_HIGH)? PIR_MotionDetected : PIR_NoMotionDetected;
+    LOC_sEXTICfg.EXTI_Line = copy_eLine;
+    LOC_sEXTICfg.EXTI_Trigger = EXTI_TRIGGER_BOTH_EDGES;
+    LOC_sEXTICfg.P_callback_func = copy_fptrEdgeCallback;
 
-    return LOC_u8PIRStatus;
+    return MCAL_EXTI_Init(&LOC_sEXTICfg);
 }
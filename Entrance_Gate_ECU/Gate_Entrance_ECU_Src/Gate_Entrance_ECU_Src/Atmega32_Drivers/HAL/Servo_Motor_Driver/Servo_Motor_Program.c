@@ -1,12 +1,12 @@
 /**
  * @file Servo_Motor_Interface.h
- * 
+ *
  * @brief This file holds the APIs definitions of the PWM controlled servo motor.
- * 
+ *
  * @author Hossam_Eid (eidhossam7@gmail.com)
- * 
+ *
  * @date 10-03-2024
- * 
+ *
  * @version 1.0
  */
 
@@ -17,7 +17,183 @@
 */
 #include "Servo_Motor_Interface.h"
 
+/** @defgroup LOCAL_MACROS
+  * @{
+  */
 
+/*Converts a degree (0 - 180) to the servo pulse width in microseconds*/
+#define SERVO_DEGREE_TO_PULSE_US(DEGREE)    ((uint16_t)((sint32_t)SERVO_PULSE_0DEGREE_US +                        \
+                                            ((((sint32_t)SERVO_PULSE_180DEGREE_US - (sint32_t)SERVO_PULSE_0DEGREE_US) \
+                                            * (sint32_t)(DEGREE)) / 180L)))
+
+#if (SERVO_PULSE_0DEGREE_US < SERVO_PULSE_180DEGREE_US)
+#define SERVO_PULSE_MIN_US                  SERVO_PULSE_0DEGREE_US
+#define SERVO_PULSE_MAX_US                  SERVO_PULSE_180DEGREE_US
+#else
+#define SERVO_PULSE_MIN_US                  SERVO_PULSE_180DEGREE_US
+#define SERVO_PULSE_MAX_US                  SERVO_PULSE_0DEGREE_US
+#endif
+
+/**
+  * @}
+  */
+
+/** @defgroup Global variables
+  * @{
+  */
+
+/** @defgroup Motion profile state, updated once per frame by the TIMER1 overflow ISR
+  * @{
+  */
+static volatile uint16_t Glob_u16PulseUs = SERVO_DEGREE_TO_PULSE_US(ServoMotor_0Degree);
+static volatile uint16_t Glob_u16TargetPulseUs = SERVO_DEGREE_TO_PULSE_US(ServoMotor_0Degree);
+
+/*Pulse width change per frame and its direction*/
+static volatile uint16_t Glob_u16SpeedUs = 0;
+static volatile boolean Glob_boolMovingUp = FALSE;
+
+static volatile boolean Glob_boolMoving = FALSE;
+static volatile Ptr_Func Glob_fptrMotionDone = NULL;
+
+static volatile uint32_t Glob_u32MoveStartMs = 0;
+static volatile uint32_t Glob_u32LastMoveTimeMs = 0;
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup Local functions
+  * @{
+  */
+
+/**
+ * @brief This function returns the distance covered until the servo stops when it moves with the given
+ *  speed in this frame then decelerates every frame after.
+ *
+ * @param copy_u16Speed : Speed of the current frame in microseconds per frame.
+ * @return uint32_t     : The stopping distance in microseconds.
+ */
+static uint32_t ServoMotor_StoppingDistance(uint16_t copy_u16Speed)
+{
+    return ((uint32_t)copy_u16Speed * ((uint32_t)copy_u16Speed + SERVO_ACCELERATION_US_PER_FRAME)) /
+           (2UL * SERVO_ACCELERATION_US_PER_FRAME);
+}
+
+/**
+ * @brief This function advances the motion profile by one frame and loads the new pulse width.
+ *
+ * @note Called from the TIMER1 overflow ISR while moving, the new compare value is used
+ * from the next frame on.
+ */
+static void ServoMotor_ProfileStep(void)
+{
+    uint16_t LOC_u16Distance;
+    uint16_t LOC_u16Speed;
+    uint16_t LOC_u16MinSpeed;
+    boolean LOC_boolTargetUp;
+
+    if(Glob_u16TargetPulseUs >= Glob_u16PulseUs)
+    {
+        LOC_u16Distance = Glob_u16TargetPulseUs - Glob_u16PulseUs;
+        LOC_boolTargetUp = TRUE;
+    }else{
+        LOC_u16Distance = Glob_u16PulseUs - Glob_u16TargetPulseUs;
+        LOC_boolTargetUp = FALSE;
+    }
+
+    if((0u != Glob_u16SpeedUs) && (Glob_boolMovingUp != LOC_boolTargetUp))
+    {
+        /*The target was changed to the other side while moving, brake before turning back*/
+        Glob_u16SpeedUs = (Glob_u16SpeedUs > SERVO_ACCELERATION_US_PER_FRAME)?
+                          (Glob_u16SpeedUs - SERVO_ACCELERATION_US_PER_FRAME) : 0u;
+
+        if(TRUE == Glob_boolMovingUp)
+        {
+            Glob_u16PulseUs = ((SERVO_PULSE_MAX_US - Glob_u16PulseUs) > Glob_u16SpeedUs)?
+                              (Glob_u16PulseUs + Glob_u16SpeedUs) : SERVO_PULSE_MAX_US;
+        }else{
+            Glob_u16PulseUs = ((Glob_u16PulseUs - SERVO_PULSE_MIN_US) > Glob_u16SpeedUs)?
+                              (Glob_u16PulseUs - Glob_u16SpeedUs) : SERVO_PULSE_MIN_US;
+        }
+    }else{
+        /*Accelerate, cruise or decelerate: take the fastest speed from which the servo can still
+          stop at the target without overshooting it*/
+        LOC_u16MinSpeed = (Glob_u16SpeedUs > (2u * SERVO_ACCELERATION_US_PER_FRAME))?
+                          (Glob_u16SpeedUs - SERVO_ACCELERATION_US_PER_FRAME) : SERVO_ACCELERATION_US_PER_FRAME;
+
+        LOC_u16Speed = Glob_u16SpeedUs + SERVO_ACCELERATION_US_PER_FRAME;
+        if(LOC_u16Speed > SERVO_MAX_SPEED_US_PER_FRAME)
+        {
+            LOC_u16Speed = SERVO_MAX_SPEED_US_PER_FRAME;
+        }else{
+
+        }
+
+        while((LOC_u16Speed > LOC_u16MinSpeed) && (ServoMotor_StoppingDistance(LOC_u16Speed) > LOC_u16Distance))
+        {
+            LOC_u16Speed = (LOC_u16Speed > (LOC_u16MinSpeed + SERVO_ACCELERATION_US_PER_FRAME))?
+                           (LOC_u16Speed - SERVO_ACCELERATION_US_PER_FRAME) : LOC_u16MinSpeed;
+        }
+
+        /*The last step lands exactly on the target*/
+        if(LOC_u16Speed > LOC_u16Distance)
+        {
+            LOC_u16Speed = LOC_u16Distance;
+        }else{
+
+        }
+
+        Glob_u16SpeedUs = LOC_u16Speed;
+        Glob_boolMovingUp = LOC_boolTargetUp;
+
+        Glob_u16PulseUs = (TRUE == LOC_boolTargetUp)? (Glob_u16PulseUs + LOC_u16Speed) :
+                                                      (Glob_u16PulseUs - LOC_u16Speed);
+    }
+
+    MCAL_TIMER1_SetCompareA(Glob_u16PulseUs);
+
+    if(Glob_u16PulseUs == Glob_u16TargetPulseUs)
+    {
+        Glob_u16SpeedUs = 0;
+        Glob_boolMoving = FALSE;
+        Glob_u32LastMoveTimeMs = TIMER1_TIME_ELAPSED(MCAL_TIMER1_Millis(), Glob_u32MoveStartMs);
+
+        if(NULL != Glob_fptrMotionDone)
+        {
+            Glob_fptrMotionDone();
+        }else{
+
+        }
+    }else{
+
+    }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup ISR_CALLBACK_FUNCTIONS
+  * @{
+  */
+
+/*Called by the TIMER1 overflow at the top of every servo frame*/
+static void Timer1_ServoFrame_Callback(void)
+{
+    if(TRUE == Glob_boolMoving)
+    {
+        ServoMotor_ProfileStep();
+    }else{
+
+    }
+}
+
+/**
+  * @}
+  */
 
 /**************************************************************************************************************************
 *===============================================
@@ -27,46 +203,98 @@
 
 /**
  * @brief This function does the required initialization to use the servo motor.
- * 
+ *
  * @return eStatus_t: E_OK if the initialization was successful, E_NOK otherwise.
+ *
+ * @note The servo is placed at the 0 degree position without a motion profile, TIMER1 keeps
+ * running the uptime clock while it generates the servo PWM.
  */
 eStatus_t HAL_ServoMotorInit(void)
 {
     eStatus_t LOC_sStatus = E_OK;
+    sTIMER1_Config_t timer1_Config;
 
-    sTIMER2_Config_t timer2_Config;
-    GPIO_Pin_Config_t GPIO_cfg;
+    Glob_boolMoving = FALSE;
+    Glob_u16SpeedUs = 0;
+    Glob_u16PulseUs = SERVO_DEGREE_TO_PULSE_US(ServoMotor_0Degree);
+    Glob_u16TargetPulseUs = Glob_u16PulseUs;
 
-    GPIO_cfg.pinNumber = GPIO_PIN7;
-    GPIO_cfg.pinMode = GPIO_MODE_OUTPUT;
-    MCAL_GPIO_Init(GPIOD, &GPIO_cfg);
+    /*The first pulse is already at the initial position*/
+    MCAL_TIMER1_SetCompareA(Glob_u16PulseUs);
 
-    timer2_Config.Timer2_CLK_SRC = Timer2_Prescale_1024;
-    timer2_Config.Timer2_Mode = Timer2_FAST_PWM_Mode;
-    timer2_Config.Timer2_COM = Timer2_COM_Set;
-    timer2_Config.Timer2_OCIE = Timer2_TOCI_Disable;
-    timer2_Config.Timer2_OIE = Timer2_TOI_Disable;
+    MCAL_TIMER1_CALLBACK_Overflow_INTERRUPT(Timer1_ServoFrame_Callback);
 
-    MCAL_TIMER2_SetCompare(ServoMotor_0Degree);
-
-    LOC_sStatus = MCAL_TIMER2_Init(& timer2_Config);
+    timer1_Config.TIMER1_CLK_SRC = TIMER1_UPTIME_CLK_SRC;
+    timer1_Config.TIMER1_Mode = TIMER1_FAST_PWM_ICR1_Mode;
+    timer1_Config.TIMER1_COM1A = TIMER1_COM_Clear;
+    timer1_Config.TIMER1_COM1B = TIMER1_COM_Disconnected;
+    timer1_Config.TIMER1_OIE = TIMER1_TOI_Enable;
+    timer1_Config.TIMER1_OCIE = TIMER1_TOCI_Disable;
+    timer1_Config.TIMER1_Top = SERVO_FRAME_PERIOD_US - 1u;
 
+    LOC_sStatus = MCAL_TIMER1_Init(& timer1_Config);
 
     return LOC_sStatus;
 }
 
 
 /**
- * @brief This function turn the servo motor with the specified degree. 
- * 
- * @param copy_eDegree : Degree to turn the servo motor with.
- * @return eStatus_t   : Status of the operation.
+ * @brief This function starts moving the servo motor to the specified degree following a trapezoidal
+ * motion profile, a new request while moving takes over from the current position and speed.
+ *
+ * @param copy_eDegree        : Degree to turn the servo motor to (0 - 180).
+ * @param copy_fptrMotionDone : Function called from the TIMER1 ISR when the position is reached, NULL for none.
+ * @return eStatus_t          : Status of the operation.
  */
-eStatus_t HAL_ServoMotorTurn(eServoMotorDegree_t copy_eDegree)
+eStatus_t HAL_ServoMotorTurn(eServoMotorDegree_t copy_eDegree, Ptr_Func copy_fptrMotionDone)
 {
     eStatus_t LOC_sStatus = E_OK;
-    
-    MCAL_TIMER2_SetCompare(copy_eDegree);
+    uint8_t LOC_u8SREG;
+
+    if(ServoMotor_180Degree < copy_eDegree)
+    {
+        LOC_sStatus = E_NOK;
+    }else{
+        LOC_u8SREG = SREG;
+        G_INTERRUPT_DISABLE;
+
+        Glob_u16TargetPulseUs = SERVO_DEGREE_TO_PULSE_US(copy_eDegree);
+        Glob_fptrMotionDone = copy_fptrMotionDone;
+        Glob_u32MoveStartMs = MCAL_TIMER1_Millis();
+        Glob_boolMoving = TRUE;
+
+        SREG = LOC_u8SREG;
+    }
 
     return LOC_sStatus;
 }
+
+/**
+ * @brief This function checks if the servo motor is still following a motion profile.
+ *
+ * @return boolean : TRUE while the servo is moving, FALSE otherwise.
+ */
+boolean HAL_ServoMotorIsMoving(void)
+{
+    return Glob_boolMoving;
+}
+
+/**
+ * @brief This function returns the duration of the last completed motion.
+ *
+ * @return uint32_t : Time from the turn request until the position was reached in milliseconds.
+ */
+uint32_t HAL_ServoMotorGetLastMoveTimeMs(void)
+{
+    uint32_t LOC_u32MoveTimeMs;
+    uint8_t LOC_u8SREG;
+
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    LOC_u32MoveTimeMs = Glob_u32LastMoveTimeMs;
+
+    SREG = LOC_u8SREG;
+
+    return LOC_u32MoveTimeMs;
+}
@@ -0,0 +1,146 @@
+/**
+**************************************************************************************************************************
+* brief     : This module contains functions for reading and writing the internal EEPROM.
+* Author    : Hossam Eid
+* Created on: 18/10/2026
+**************************************************************************************************************************
+* Description: This file contains the function prototypes and definitions for the EEPROM driver, the writes are
+*              queued and written in the background by the EEPROM ready interrupt.
+**************************************************************************************************************************
+*/
+
+#ifndef ATMEGA32_EEPROM_H_
+#define ATMEGA32_EEPROM_H_
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Atmega32.h"
+
+/**************************************************************************************************************************
+*===============================================
+*         Macros Configuration References
+*===============================================
+*/
+
+/*Size of the internal EEPROM in bytes*/
+#define EEPROM_SIZE                     1024u
+
+/** @defgroup EEPROM_CONFIGURATION
+  * @{
+  */
+
+/*Bytes the write queue holds, a power of 2 not larger than 128, one slot is kept free*/
+#define EEPROM_WRITE_BUFFER_SIZE        64u
+
+/*Blocks the write queue holds, a power of 2*/
+#define EEPROM_WRITE_QUEUE_SIZE         8u
+
+/*The read cache holds the last lines read, a line is filled from the EEPROM on a miss*/
+#define EEPROM_READ_CACHE_LINES         4u
+#define EEPROM_READ_CACHE_LINE_SIZE     8u
+/**
+  * @}
+  */
+
+#define ASSERT_EEPROM_BLOCK(addr, len)  (((uint32_t)(addr) + (uint32_t)(len)) <= EEPROM_SIZE)
+
+/** @defgroup EEPROM_RECORD
+  * @brief A record is kept in two copies of {payload, CRC-8, sequence}, a write goes to the older copy
+  * so the newer one stays valid until the write is complete. The sequence is written last, a copy cut
+  * before it's complete keeps the old sequence even if its CRC matches by chance.
+  * @{
+  */
+#define EEPROM_RECORD_OVERHEAD          2u
+#define EEPROM_RECORD_COPY_SIZE(SIZE)   ((SIZE) + EEPROM_RECORD_OVERHEAD)
+
+/*EEPROM bytes taken by a record with the given payload size*/
+#define EEPROM_RECORD_FOOTPRINT(SIZE)   (2u * EEPROM_RECORD_COPY_SIZE(SIZE))
+
+#define EEPROM_RECORD_NO_COPY           0xFFu
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+*===============================================
+* User type definitions (structures)
+*===============================================
+*/
+
+typedef struct{
+    uint16_t u16Address;                    /*!<Address of the first copy, the second copy follows it*/
+    uint8_t  u8Size;                        /*!<Size of the payload in bytes*/
+    uint8_t  u8Sequence;                    /*!<Sequence of the newest copy, kept by the driver*/
+    uint8_t  u8ActiveCopy;                  /*!<Index of the newest copy, EEPROM_RECORD_NO_COPY if none, kept by the driver*/
+}sEEPROM_Record_t;
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Supported by "MCAL EEPROM DRIVER"
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_Read
+* @brief		:   Reads a block of bytes from the EEPROM, the bytes still in the write queue are read as queued.
+* @param [in]	:   copy_u16Address: Address of the first byte in the EEPROM.
+* @param [out]	:   ptr_u8Data: Buffer to hold the read bytes.
+* @param [in]	:   copy_u16Length: Number of bytes to read.
+* @return       :   eStatus_t: Status of the function call.
+* @Note         :   A read cache miss waits for the byte being written, at most one byte write time (8.5 ms).
+*               :   Must only be called from the main loop.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_Read(uint16_t copy_u16Address, uint8_t* ptr_u8Data, uint16_t copy_u16Length);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_Write
+* @brief		:   Queues a block of bytes to be written to the EEPROM by the EEPROM ready interrupt.
+* @param [in]	:   copy_u16Address: Address of the first byte in the EEPROM.
+* @param [in]	:   ptr_u8Data: Bytes to write.
+* @param [in]	:   copy_u8Length: Number of bytes to write.
+* @return       :   eStatus_t: E_OK if the block was queued, E_NOK if there is no room for it (nothing is queued).
+* @Note         :   The bytes that already hold their value are skipped. Must only be called from the main loop.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_Write(uint16_t copy_u16Address, const uint8_t* ptr_u8Data, uint8_t copy_u8Length);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_IsBusy
+* @brief		:   Checks if the EEPROM is still writing the queued bytes.
+* @return       :   boolean: TRUE until the last queued byte is written.
+======================================================================================================================
+*/
+boolean MCAL_EEPROM_IsBusy(void);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_ReadRecord
+* @brief		:   Reads the newest valid copy of a record.
+* @param [in]	:   ptr_sRecord: The record, its sequence and active copy are updated for the next write.
+* @param [out]	:   ptr_u8Payload: Buffer to hold the payload.
+* @return       :   eStatus_t: E_OK if a valid copy was found, E_NOK otherwise.
+* @Note         :   Must be called once before the record is written.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_ReadRecord(sEEPROM_Record_t* ptr_sRecord, uint8_t* ptr_u8Payload);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_WriteRecord
+* @brief		:   Queues a new version of a record to be written over its older copy.
+* @param [in]	:   ptr_sRecord: The record.
+* @param [in]	:   ptr_u8Payload: The new payload.
+* @return       :   eStatus_t: E_OK if the record was queued, E_NOK if there is no room for it.
+* @Note         :   A reset before the copy is written leaves the previous version as the newest valid copy.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_WriteRecord(sEEPROM_Record_t* ptr_sRecord, const uint8_t* ptr_u8Payload);
+
+#endif /* ATMEGA32_EEPROM_H_ */
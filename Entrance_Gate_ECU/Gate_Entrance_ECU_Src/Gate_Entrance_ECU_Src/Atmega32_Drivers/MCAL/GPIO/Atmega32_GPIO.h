@@ -162,4 +162,71 @@ void MCAL_GPIO_WritePort(volatile GPIO_typedef * GPIOx, uint8_t value);
 */
 void MCAL_GPIO_TogglePin(volatile GPIO_typedef * GPIOx, uint8_t pinNumber);
 
+/********************************************************
+===============================================
+* Inline pin access (compile-time resolved)
+*===============================================
+*/
+
+/*
+ * The following accessors are always inlined, so when the port and the pin are compile-time
+ * constants (e.g. GPIOB, GPIO_PIN3) the compiler folds each of them into a single
+ * sbi/cbi instruction for writes and sbic/sbis for reads instead of a call into the driver.
+ * Use them in the HAL drivers and ISR paths; the out-of-line APIs above remain for the
+ * cases where the port is only known at run time.
+ */
+#define GPIO_FORCE_INLINE       static inline __attribute__((always_inline))
+
+/*
+===============================================================+
+* @Func_name	:   MCAL_GPIO_FastWritePin.
+* @brief		:   Write a value on GPIOx PINy, resolved at compile time to sbi/cbi.
+* @param [in]	:   GPIOx where x can be (A >> D) to select the GPIO peripheral.
+* @param [in]	:   The number of the pin to be written must be a value of @ref GPIO_PIN_define.
+* @param [in]	:   The pin value must be a value of @ref GPIO_PIN_STATUS.
+* @return_value :   none.
+* Note			:   none.
+*===============================================
+*/
+GPIO_FORCE_INLINE void MCAL_GPIO_FastWritePin(volatile GPIO_typedef * GPIOx, uint8_t pinNumber, uint8_t value)
+{
+    if(value == GPIO_PIN_HIGH)
+    {
+        GPIOx->PORT |= (uint8_t)(1u << pinNumber);
+    }else{
+        GPIOx->PORT &= (uint8_t)~(1u << pinNumber);
+    }
+}
+
+/*
+===============================================================+
+* @Func_name	:   MCAL_GPIO_FastReadPin.
+* @brief		:   Reads the status of GPIOx PINy, resolved at compile time to sbic/sbis.
+* @param [in]	:   GPIOx where x can be (A >> D) to select the GPIO peripheral.
+* @param [in]	:   The number of the pin to be read must be a value of @ref GPIO_PIN_define.
+* @return_value :   Current pin status which can be a value of @ref GPIO_PIN_STATUS.
+* Note			:   none.
+*===============================================
+*/
+GPIO_FORCE_INLINE uint8_t MCAL_GPIO_FastReadPin(volatile GPIO_typedef * GPIOx, uint8_t pinNumber)
+{
+    return (GPIOx->PIN & (uint8_t)(1u << pinNumber))? (uint8_t)(GPIO_PIN_HIGH): (uint8_t)(GPIO_PIN_LOW);
+}
+
+/*
+===============================================================+
+* @Func_name	:   MCAL_GPIO_FastTogglePin.
+* @brief		:   Toggle the value of GPIOx PINy without a function call.
+* @param [in]	:   GPIOx where x can be (A >> D) to select the GPIO peripheral.
+* @param [in]	:   The number of the pin to be toggled must be a value of @ref GPIO_PIN_define.
+* @return_value :   none.
+* Note			:   The Atmega32 can't toggle a pin by writing to PINx, so this is an in/eor/out
+*                   sequence which is not atomic against ISRs writing the same port.
+*===============================================
+*/
+GPIO_FORCE_INLINE void MCAL_GPIO_FastTogglePin(volatile GPIO_typedef * GPIOx, uint8_t pinNumber)
+{
+    GPIOx->PORT ^= (uint8_t)(1u << pinNumber);
+}
+
 #endif /* ATMEGA32_GPIO_H_ */
\ No newline at end of file
@@ -23,17 +23,17 @@
 *           LOCAL MACROS
 *===============================================
 */
-/** @defgroup BAUDRATE_CALCULATION_MACROS
+/** @defgroup TX_BUFFER_MACROS
   * @{
   */
-#define USART_NORMAL_MODE           16u
-#define USART_2xSPEED_MODE          8u
-#define USART_SYNCH_MODE            2u
+#if ((USART_TX_BUFFER_SIZE & (USART_TX_BUFFER_SIZE - 1u)) != 0u) || (USART_TX_BUFFER_SIZE > 128u)
+#error "USART_TX_BUFFER_SIZE must be a power of 2 not larger than 128"
+#endif
 
-#define USART_UBRR_VALUE(CLK, baudRate, mode)     ((uint16_t)((F_CPU / (mode * baudRate)) - 1))
-
-#define USART_ASSERT_UBRR_VALUE(ubrr) ((ubrr >= 0) && (ubrr <= 4095))
+#define USART_TX_BUFFER_MASK        (USART_TX_BUFFER_SIZE - 1u)
 
+/*Number of free slots in the transmit buffer*/
+#define USART_TX_BUFFER_FREE()      ((uint8_t)(USART_TX_BUFFER_MASK - ((LOC_u8TxHead - LOC_u8TxTail) & USART_TX_BUFFER_MASK)))
 /**
   * @}
   */
@@ -49,12 +49,55 @@ static Ptr_Func LOC_fptr_RXC_callback  = NULL;
 static Ptr_Func LOC_fptr_TXC_callback  = NULL;
 static Ptr_Func LOC_fptr_UDRE_callback = NULL;
 
+/** @defgroup Transmit ring buffer, the head is moved by the writers and the tail by the UDRE ISR
+  * @{
+  */
+static uint8_t LOC_u8TxBuffer[USART_TX_BUFFER_SIZE];
+static volatile uint8_t LOC_u8TxHead = 0;
+static volatile uint8_t LOC_u8TxTail = 0;
+
+/*Set when the TX channel is disabled while the buffer still holds data*/
+static volatile uint8_t LOC_u8TxDisablePending = 0;
+/**
+  * @}
+  */
+
 /**************************************************************************************************************************
 ===============================================
 *           Private Functions
 *===============================================
 */
 
+/**
+======================================================================================================================
+* @Func_name	:   USART_TxBuffer_UDRE_Handler
+* @brief		:   Moves the next byte from the transmit buffer to UDR, and disables the UDRE interrupt once
+*               :   the buffer is empty.
+* @note			:   Called from the UDRE ISR.
+======================================================================================================================
+*/
+static void USART_TxBuffer_UDRE_Handler(void)
+{
+    if(LOC_u8TxHead != LOC_u8TxTail)
+    {
+        USART->UDR = LOC_u8TxBuffer[LOC_u8TxTail];
+
+        LOC_u8TxTail = (LOC_u8TxTail + 1u) & USART_TX_BUFFER_MASK;
+    }else{
+        CLEAR_BIT(USART->UCSRB, USART_UCSRB_UDREIE_POS);
+
+        if(LOC_u8TxDisablePending)
+        {
+            /*The hardware keeps the channel on until the last frame is shifted out*/
+            USART->UCSRB &= ~(USART_UCSRB_TXEN_MASK);
+
+            LOC_u8TxDisablePending = 0;
+        }else{
+
+        }
+    }
+}
+
 
 /**************************************************************************************************************************
 ===============================================
@@ -76,29 +119,21 @@ eStatus_t MCAL_UART_Init(sUSART_config_t* config)
 {
     eStatus_t LOC_status = E_OK;
     uint16_t  LOC_u16BaudRate = 0;
-    uint8_t   LOC_u8BaudRateDivisor = 0;
     uint8_t   LOC_u8TempReg = 0;
 
     LOC_cfg = *config;
 
-    /*1. Calculate the baud-rate*/
-    /*Determina the appropriate divisor based on the clock mode*/
-    LOC_u8BaudRateDivisor = (config->USART_CLKOperation == USART_CLKOP_NormalAsynch)? USART_NORMAL_MODE :
-                            (config->USART_CLKOperation == USART_CLKOP_2xSpeedAsynch)? USART_2xSPEED_MODE : USART_SYNCH_MODE; 
-
-    /*Calculate the baudrate*/
-    LOC_u16BaudRate = USART_UBRR_VALUE(F_CPU, config->USART_baudRate, LOC_u8BaudRateDivisor);
+    /*1. Set the baud-rate, UBRR and the speed mode are computed at compile time by USART_BAUD_CONFIG*/
+    LOC_u16BaudRate = config->USART_baudRate & USART_BAUD_CONFIG_UBRR_MASK;
     
-    if(USART_ASSERT_UBRR_VALUE(LOC_u16BaudRate))
+    if((config->USART_CLKOperation != USART_CLKOP_Synch) ||
+       !(config->USART_baudRate & USART_BAUD_CONFIG_U2X_FLAG))
     {
-        USART->UBRRL = (uint8_t)(LOC_u16BaudRate);
-        
-        if(LOC_u16BaudRate > 255)
-        {
-            USART_UBRRH = (((uint8_t)0x0F) & ((uint8_t)(LOC_u16BaudRate >> 8)));
-        }else{
+        /*UBRRH shares its address with UCSRC, writing it with URSEL = 0 selects UBRRH,
+          and the prescaler is updated when UBRRL is written so it goes last*/
+        USART_UBRRH = (((uint8_t)0x0F) & ((uint8_t)(LOC_u16BaudRate >> 8)));
 
-        }
+        USART->UBRRL = (uint8_t)(LOC_u16BaudRate);
 
         /** @defgroup Configuring the UCSRC frame format
           * @{
@@ -112,7 +147,7 @@ eStatus_t MCAL_UART_Init(sUSART_config_t* config)
         }else{
             LOC_u8TempReg &= ~(USART_UCSRC_UMSEL_MASK);
 
-            if(config->USART_CLKOperation == USART_CLKOP_2xSpeedAsynch)
+            if(config->USART_baudRate & USART_BAUD_CONFIG_U2X_FLAG)
             {
                 /*Enbale the 2x speed mode*/
                 USART->UCSRA |= USART_UCSRA_U2X_MASK;
@@ -184,7 +219,21 @@ void MCAL_UART_RESET()
 */
 void MCAL_UART_Disable()
 {
-    USART->UCSRB &= ~(USART_UCSRB_RXEN_MASK | USART_UCSRB_TXEN_MASK);
+    uint8_t LOC_u8SREG = SREG;
+
+    G_INTERRUPT_DISABLE;
+
+    if(LOC_u8TxHead != LOC_u8TxTail)
+    {
+        /*Let the UDRE handler turn the TX channel off after the buffer is drained*/
+        USART->UCSRB &= ~(USART_UCSRB_RXEN_MASK);
+
+        LOC_u8TxDisablePending = 1;
+    }else{
+        USART->UCSRB &= ~(USART_UCSRB_RXEN_MASK | USART_UCSRB_TXEN_MASK);
+    }
+
+    SREG = LOC_u8SREG;
 }
 
 /**
@@ -196,6 +245,8 @@ void MCAL_UART_Disable()
 */
 void MCAL_UART_Enable()
 {
+    LOC_u8TxDisablePending = 0;
+
     USART->UCSRB |= LOC_cfg.USART_Mode;
 }
 
@@ -267,6 +318,9 @@ eStatus_t MCAL_UART_Get_Data(uint16_t* pRxBuffer, eUSART_PollingMode_t PollingEn
     {
         LOC_eStatus = E_NOK;
 
+        /*Drop the corrupted byte, otherwise the RXC flag stays set*/
+        (void)USART->UDR;
+
     }else{
         *pRxBuffer = 0;
         
@@ -291,19 +345,76 @@ eStatus_t MCAL_UART_Get_Data(uint16_t* pRxBuffer, eUSART_PollingMode_t PollingEn
 * @param [in]	:   string to send.
 * @param [out]	:   none.
 * @return       :   none.
-* @note			:   This function works with the polling mechanism.
+* @note			:   The string is queued in the transmit buffer, the function only waits when the buffer is full.
 ======================================================================================================================
 */
 void MCAL_USART_Send_String(uint8_t* string)
 {
     while(*string)
     {
-        MCAL_UART_Send_Data((uint16_t *)string, USART_PollingEnabled);
+        /*Wait for room only when the buffer is full*/
+        while(MCAL_UART_Write(string, 1) != E_OK)
+        {
+
+        }
 		
 		string++;
     }
 }
 
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_UART_Write
+* @brief		:   Queues a block of bytes in the transmit buffer to be sent by the UDRE interrupt.
+* @param [in]	:   pu8Buffer: pointer to the bytes to be sent.
+* @param [in]	:   u8Length: number of bytes to be sent.
+* @return       :   eStatus_t: E_OK if all the bytes were queued, E_NOK if there is no room for them (nothing is queued).
+* @note			:   This function never waits for the hardware, it's safe to call from the main loop and from ISRs.
+*               :   The UDRE interrupt is owned by the transmit buffer while it's draining.
+======================================================================================================================
+*/
+eStatus_t MCAL_UART_Write(const uint8_t* pu8Buffer, uint8_t u8Length)
+{
+    eStatus_t LOC_eStatus = E_OK;
+    uint8_t   LOC_u8SREG;
+    uint8_t   LOC_u8Head;
+
+    if((pu8Buffer == NULL) || (u8Length == 0))
+    {
+        LOC_eStatus = E_NOK;
+    }else{
+        /*Writers may run in the main loop and in ISRs, so the head is updated with the interrupts off*/
+        LOC_u8SREG = SREG;
+
+        G_INTERRUPT_DISABLE;
+
+        if(u8Length > USART_TX_BUFFER_FREE())
+        {
+            LOC_eStatus = E_NOK;
+        }else{
+            LOC_u8Head = LOC_u8TxHead;
+
+            while(u8Length--)
+            {
+                LOC_u8TxBuffer[LOC_u8Head] = *pu8Buffer++;
+
+                LOC_u8Head = (LOC_u8Head + 1u) & USART_TX_BUFFER_MASK;
+            }
+
+            LOC_u8TxHead = LOC_u8Head;
+
+            /*Start draining, UDRE fires right away if the data register is already empty*/
+            LOC_fptr_UDRE_callback = USART_TxBuffer_UDRE_Handler;
+
+            SET_BIT(USART->UCSRB, USART_UCSRB_UDREIE_POS);
+        }
+
+        SREG = LOC_u8SREG;
+    }
+
+    return LOC_eStatus;
+}
+
 /**
 ======================================================================================================================
 * @Func_name	:   MCAL_USART_Get_String
@@ -0,0 +1,451 @@
+/**
+ * @file EEPROM_Record_Test.c
+ *
+ * @brief Host test of the MCAL EEPROM driver against a timing model of the Atmega32 EEPROM, the byte writes take
+ *  8.5 ms and are started by the EEPROM ready ISR. The power is cut at every point of a record write and the
+ *  record read back after the reboot must be the previous or the new version, never a half written copy.
+ *
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ *
+ * @date 18-10-2026
+ *
+ * @version 1.0
+ */
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+/*The driver translation unit is built in the test so a reboot can clear its RAM*/
+#include "EEPROM/Atmega32_EEPROM.c"
+#include "Host_Test.h"
+
+/** @defgroup Local Macros
+  * @{
+  */
+/*Timing of the model, a byte write and the time taken by one register access of the driver*/
+#define MODEL_BYTE_WRITE_US         8500u
+#define MODEL_ACCESS_US             1u
+
+#define MODEL_ERASED_BYTE           0xFFu
+#define MODEL_SREG_I_MASK           (1u << 7)
+
+#define TEST_RECORD_ADDRESS         0x40u
+#define TEST_RECORD_SIZE            6u
+#define TEST_RECORD_TRIALS          200u
+#define TEST_SEED                   0x2545F491u
+
+#define TEST_BLOCK_ADDRESS          0x104u
+#define TEST_BLOCK_SIZE             10u
+/**
+  * @}
+  */
+
+/**
+ * @brief State of the EEPROM model.
+ *
+ */
+typedef struct{
+    EEPROM_typedef sRegisters;
+    uint8_t  au8Memory[EEPROM_SIZE];
+    uint32_t u32Now;                    /*Time in us*/
+    boolean  boolWriting;
+    uint32_t u32WriteStart;
+    uint16_t u16WriteAddress;
+    uint8_t  u8WriteData;
+    uint32_t u32Writes;                 /*Bytes written since the model was erased*/
+    uint32_t u32Violations;             /*Register accesses the datasheet forbids*/
+}sEEPROM_Model_t;
+
+static sEEPROM_Model_t Glob_sModel;
+
+volatile uint8_t Host_u8SREG = MODEL_SREG_I_MASK;
+
+static uint32_t Glob_u32Seed = TEST_SEED;
+
+/**************************************************************************************************************************
+===============================================
+*               EEPROM model
+*===============================================
+*/
+
+/**
+ * @brief This function acts on what the driver wrote to the registers since the last access.
+ *
+ */
+static void Model_Settle(void)
+{
+    EEPROM_typedef* LOC_psRegisters = &Glob_sModel.sRegisters;
+
+    if((TRUE == Glob_sModel.boolWriting) && ((Glob_sModel.u32Now - Glob_sModel.u32WriteStart) >= MODEL_BYTE_WRITE_US))
+    {
+        Glob_sModel.au8Memory[Glob_sModel.u16WriteAddress] = Glob_sModel.u8WriteData;
+        Glob_sModel.u32Writes++;
+        Glob_sModel.boolWriting = FALSE;
+
+        LOC_psRegisters->EECR &= ~(EEPROM_EECR_EEWE_MASK);
+    }else{
+
+    }
+
+    /*Neither a read nor a new address is possible while a byte is written*/
+    if((TRUE == Glob_sModel.boolWriting) &&
+       ((LOC_psRegisters->EECR & EEPROM_EECR_EERE_MASK) || (LOC_psRegisters->EEAR != Glob_sModel.u16WriteAddress)))
+    {
+        Glob_sModel.u32Violations++;
+    }else{
+
+    }
+
+    if(LOC_psRegisters->EECR & EEPROM_EECR_EERE_MASK)
+    {
+        LOC_psRegisters->EEDR = Glob_sModel.au8Memory[LOC_psRegisters->EEAR % EEPROM_SIZE];
+        LOC_psRegisters->EECR &= ~(EEPROM_EECR_EERE_MASK);
+    }else{
+
+    }
+
+    if((FALSE == Glob_sModel.boolWriting) && (LOC_psRegisters->EECR & EEPROM_EECR_EEWE_MASK))
+    {
+        if(LOC_psRegisters->EECR & EEPROM_EECR_EEMWE_MASK)
+        {
+            Glob_sModel.boolWriting = TRUE;
+            Glob_sModel.u32WriteStart = Glob_sModel.u32Now;
+            Glob_sModel.u16WriteAddress = LOC_psRegisters->EEAR % EEPROM_SIZE;
+            Glob_sModel.u8WriteData = LOC_psRegisters->EEDR;
+        }else{
+            /*EEWE without EEMWE is ignored by the EEPROM*/
+            Glob_sModel.u32Violations++;
+            LOC_psRegisters->EECR &= ~(EEPROM_EECR_EEWE_MASK);
+        }
+
+        LOC_psRegisters->EECR &= ~(EEPROM_EECR_EEMWE_MASK);
+    }else{
+
+    }
+}
+
+EEPROM_typedef* Host_EEPROM_Access(void)
+{
+    Model_Settle();
+
+    Glob_sModel.u32Now += MODEL_ACCESS_US;
+
+    return &Glob_sModel.sRegisters;
+}
+
+/**
+ * @brief This function lets the time go by, the EEPROM ready ISR runs whenever the EEPROM is ready and the
+ *  interrupt is enabled.
+ *
+ */
+static void Model_Run(uint32_t copy_u32Time)
+{
+    uint32_t LOC_u32End = Glob_sModel.u32Now + copy_u32Time;
+
+    Model_Settle();
+
+    while(Glob_sModel.u32Now < LOC_u32End)
+    {
+        if(TRUE == Glob_sModel.boolWriting)
+        {
+            Glob_sModel.u32Now = ((Glob_sModel.u32WriteStart + MODEL_BYTE_WRITE_US) < LOC_u32End)?
+                                 (Glob_sModel.u32WriteStart + MODEL_BYTE_WRITE_US) : LOC_u32End;
+
+        }else if((Glob_sModel.sRegisters.EECR & EEPROM_EECR_EERIE_MASK) && (Host_u8SREG & MODEL_SREG_I_MASK)){
+
+            __vector_17();
+        }else{
+            Glob_sModel.u32Now = LOC_u32End;
+        }
+
+        Model_Settle();
+    }
+}
+
+/**
+ * @brief This function runs the model until the driver has written everything queued.
+ *
+ * @return uint32_t : The time taken in us.
+ */
+static uint32_t Model_Drain(void)
+{
+    uint32_t LOC_u32Start = Glob_sModel.u32Now;
+
+    while(TRUE == MCAL_EEPROM_IsBusy())
+    {
+        Model_Run(100u);
+    }
+
+    return Glob_sModel.u32Now - LOC_u32Start;
+}
+
+/**
+ * @brief This function cuts the power, a byte being written is left erased in the first half of the write
+ *  and with some of its bits still not programmed in the second half.
+ *
+ */
+static void Model_PowerCut(void)
+{
+    Model_Settle();
+
+    if(TRUE == Glob_sModel.boolWriting)
+    {
+        Glob_u32Seed = (Glob_u32Seed * 1103515245u) + 12345u;
+
+        Glob_sModel.au8Memory[Glob_sModel.u16WriteAddress] =
+            ((Glob_sModel.u32Now - Glob_sModel.u32WriteStart) < (MODEL_BYTE_WRITE_US / 2u))? MODEL_ERASED_BYTE :
+            (uint8_t)(Glob_sModel.u8WriteData | (uint8_t)(Glob_u32Seed >> 16));
+
+        Glob_sModel.boolWriting = FALSE;
+    }else{
+
+    }
+
+    memset(&Glob_sModel.sRegisters, 0, sizeof(Glob_sModel.sRegisters));
+}
+
+/**
+ * @brief This function boots the driver again, its queue and read cache are lost with the RAM.
+ *
+ */
+static void Model_Reboot(void)
+{
+    Glob_u8DataHead = 0;
+    Glob_u8DataTail = 0;
+    Glob_u8JobHead = 0;
+    Glob_u8JobTail = 0;
+    Glob_u8JobOffset = 0;
+
+    memset(Glob_au8ReadCacheTag, EEPROM_CACHE_EMPTY_TAG, sizeof(Glob_au8ReadCacheTag));
+
+    Host_u8SREG = MODEL_SREG_I_MASK;
+}
+
+/**
+ * @brief This function erases the EEPROM and boots the driver.
+ *
+ */
+static void Model_Erase(void)
+{
+    memset(&Glob_sModel, 0, sizeof(Glob_sModel));
+    memset(Glob_sModel.au8Memory, MODEL_ERASED_BYTE, sizeof(Glob_sModel.au8Memory));
+
+    Model_Reboot();
+}
+
+/**************************************************************************************************************************
+===============================================
+*               Private Functions
+*===============================================
+*/
+
+/**
+ * @brief This function fills a payload with random bytes, every byte differs from the same byte of the other payload.
+ *
+ */
+static void Test_RandomPayload(uint8_t* ptr_u8Payload, const uint8_t* ptr_u8Other)
+{
+    uint8_t LOC_u8Index;
+
+    for(LOC_u8Index = 0; LOC_u8Index < TEST_RECORD_SIZE; LOC_u8Index++)
+    {
+        do{
+            Glob_u32Seed = (Glob_u32Seed * 1103515245u) + 12345u;
+            ptr_u8Payload[LOC_u8Index] = (uint8_t)(Glob_u32Seed >> 16);
+        }while((NULL != ptr_u8Other) && (ptr_u8Payload[LOC_u8Index] == ptr_u8Other[LOC_u8Index]));
+    }
+}
+
+/**
+ * @brief This function checks the queue drained by the ISR, the queued bytes are read back before and while they
+ *  are written, the bytes holding their value are skipped and a full queue takes nothing.
+ *
+ */
+static void Test_WriteQueueDrain(void)
+{
+    uint8_t LOC_au8Block[TEST_BLOCK_SIZE] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA};
+    uint8_t LOC_au8Read[TEST_BLOCK_SIZE];
+    uint8_t LOC_u8Byte = 0x5Au;
+    uint32_t LOC_u32Start;
+    uint8_t LOC_u8Blocks = 0;
+
+    Model_Erase();
+
+    /*Three bytes already hold their value*/
+    Glob_sModel.au8Memory[TEST_BLOCK_ADDRESS + 1u] = LOC_au8Block[1];
+    Glob_sModel.au8Memory[TEST_BLOCK_ADDRESS + 4u] = LOC_au8Block[4];
+    Glob_sModel.au8Memory[TEST_BLOCK_ADDRESS + 9u] = LOC_au8Block[9];
+
+    LOC_u32Start = Glob_sModel.u32Now;
+
+    HOST_TEST_CHECK("queue block", E_OK == MCAL_EEPROM_Write(TEST_BLOCK_ADDRESS, LOC_au8Block, TEST_BLOCK_SIZE));
+    HOST_TEST_CHECK("queued read", (E_OK == MCAL_EEPROM_Read(TEST_BLOCK_ADDRESS, LOC_au8Read, 4u)) &&
+                                   (0 == memcmp(LOC_au8Read, LOC_au8Block, 4u)));
+
+    /*The second line is read from the EEPROM while a byte is written, the queued bytes go over it*/
+    Model_Run(20000u);
+    HOST_TEST_CHECK("write in progress", TRUE == Glob_sModel.boolWriting);
+    HOST_TEST_CHECK("read during drain", (E_OK == MCAL_EEPROM_Read(TEST_BLOCK_ADDRESS + 4u, LOC_au8Read, 6u)) &&
+                                         (0 == memcmp(LOC_au8Read, &LOC_au8Block[4], 6u)));
+
+    (void)Model_Drain();
+
+    HOST_TEST_CHECK("drained", 0 == memcmp(&Glob_sModel.au8Memory[TEST_BLOCK_ADDRESS], LOC_au8Block, TEST_BLOCK_SIZE));
+    HOST_TEST_CHECK("skipped bytes", 7u == Glob_sModel.u32Writes);
+    HOST_TEST_CHECK("drain time", ((Glob_sModel.u32Now - LOC_u32Start) >= (7u * MODEL_BYTE_WRITE_US)) &&
+                                  ((Glob_sModel.u32Now - LOC_u32Start) < (8u * MODEL_BYTE_WRITE_US)));
+
+    /*Fill the queue, the block that doesn't fit is not queued at all*/
+    while(E_OK == MCAL_EEPROM_Write((uint16_t)(0x200u + LOC_u8Blocks), &LOC_u8Byte, 1u))
+    {
+        LOC_u8Blocks++;
+    }
+
+    HOST_TEST_CHECK("queue full", (EEPROM_WRITE_QUEUE_SIZE - 1u) == LOC_u8Blocks);
+
+    (void)Model_Drain();
+
+    HOST_TEST_CHECK("rejected block", MODEL_ERASED_BYTE == Glob_sModel.au8Memory[0x200u + LOC_u8Blocks]);
+    HOST_TEST_CHECK("queue drained", (7u + LOC_u8Blocks) == Glob_sModel.u32Writes);
+    HOST_TEST_CHECK("register protocol", 0u == Glob_sModel.u32Violations);
+}
+
+/**
+ * @brief This function writes a record over and over with a reboot after each version, the sequence wraps around.
+ *
+ */
+static void Test_RecordVersions(void)
+{
+    sEEPROM_Record_t LOC_sRecord = {TEST_RECORD_ADDRESS, TEST_RECORD_SIZE, 0, 0};
+    uint8_t LOC_au8Payload[TEST_RECORD_SIZE] = {0};
+    uint8_t LOC_au8Read[TEST_RECORD_SIZE];
+    uint32_t LOC_u32Time = 0;
+    uint16_t LOC_u16Version;
+
+    Model_Erase();
+
+    HOST_TEST_CHECK("erased record", E_NOK == MCAL_EEPROM_ReadRecord(&LOC_sRecord, LOC_au8Read));
+    HOST_TEST_CHECK("erased record", EEPROM_RECORD_NO_COPY == LOC_sRecord.u8ActiveCopy);
+
+    for(LOC_u16Version = 0; LOC_u16Version < 600u; LOC_u16Version++)
+    {
+        memcpy(LOC_au8Read, LOC_au8Payload, TEST_RECORD_SIZE);
+        Test_RandomPayload(LOC_au8Payload, LOC_au8Read);
+
+        HOST_TEST_CHECK("queue record", E_OK == MCAL_EEPROM_WriteRecord(&LOC_sRecord, LOC_au8Payload));
+
+        LOC_u32Time += Model_Drain();
+
+        Model_Reboot();
+
+        HOST_TEST_CHECK("record version", (E_OK == MCAL_EEPROM_ReadRecord(&LOC_sRecord, LOC_au8Read)) &&
+                                          (0 == memcmp(LOC_au8Read, LOC_au8Payload, TEST_RECORD_SIZE)));
+    }
+
+    HOST_TEST_CHECK("register protocol", 0u == Glob_sModel.u32Violations);
+
+    printf("EEPROM_Record_Test: a %u byte record copy takes %lu us to write\n",
+           (unsigned int)EEPROM_RECORD_COPY_SIZE(TEST_RECORD_SIZE), (unsigned long)(LOC_u32Time / 600u));
+}
+
+/**
+ * @brief This function cuts the power at every point of a record write, the record read after the reboot must be
+ *  the previous version until the new copy is complete and the new version after, then the record is written again.
+ *
+ */
+static void Test_PowerCutDuringRecordWrite(void)
+{
+    static uint8_t LOC_au8Image[EEPROM_SIZE];
+    sEEPROM_Record_t LOC_sRecord = {TEST_RECORD_ADDRESS, TEST_RECORD_SIZE, 0, 0};
+    uint8_t LOC_au8Older[TEST_RECORD_SIZE];
+    uint8_t LOC_au8Previous[TEST_RECORD_SIZE];
+    uint8_t LOC_au8New[TEST_RECORD_SIZE];
+    uint8_t LOC_au8Read[TEST_RECORD_SIZE];
+    uint16_t LOC_u16Trial;
+    uint32_t LOC_u32Cut;
+    uint32_t LOC_u32WriteTime;
+    uint32_t LOC_u32HalfWritten = 0;
+    uint32_t LOC_u32Wrong = 0;
+    eStatus_t LOC_eStatus;
+
+    for(LOC_u16Trial = 0; LOC_u16Trial < TEST_RECORD_TRIALS; LOC_u16Trial++)
+    {
+        Test_RandomPayload(LOC_au8Older, NULL);
+        Test_RandomPayload(LOC_au8Previous, LOC_au8Older);
+        Test_RandomPayload(LOC_au8New, LOC_au8Older);
+
+        /*Both copies valid, the new version goes over the older one*/
+        Model_Erase();
+        (void)MCAL_EEPROM_ReadRecord(&LOC_sRecord, LOC_au8Read);
+        (void)MCAL_EEPROM_WriteRecord(&LOC_sRecord, LOC_au8Older);
+        (void)MCAL_EEPROM_WriteRecord(&LOC_sRecord, LOC_au8Previous);
+        (void)Model_Drain();
+
+        memcpy(LOC_au8Image, Glob_sModel.au8Memory, EEPROM_SIZE);
+
+        (void)MCAL_EEPROM_WriteRecord(&LOC_sRecord, LOC_au8New);
+        LOC_u32WriteTime = Model_Drain();
+
+        /*Cut in both halves of every byte write and just after each byte*/
+        for(LOC_u32Cut = 0; LOC_u32Cut <= LOC_u32WriteTime; LOC_u32Cut += (MODEL_BYTE_WRITE_US / 4u))
+        {
+            memcpy(Glob_sModel.au8Memory, LOC_au8Image, EEPROM_SIZE);
+            memset(&Glob_sModel.sRegisters, 0, sizeof(Glob_sModel.sRegisters));
+            Model_Reboot();
+
+            LOC_eStatus = MCAL_EEPROM_ReadRecord(&LOC_sRecord, LOC_au8Read);
+            HOST_TEST_CHECK("before the cut", (E_OK == LOC_eStatus) && (0 == memcmp(LOC_au8Read, LOC_au8Previous, TEST_RECORD_SIZE)));
+
+            (void)MCAL_EEPROM_WriteRecord(&LOC_sRecord, LOC_au8New);
+            Model_Run(LOC_u32Cut);
+            Model_PowerCut();
+            Model_Reboot();
+
+            LOC_eStatus = MCAL_EEPROM_ReadRecord(&LOC_sRecord, LOC_au8Read);
+
+            if((E_OK != LOC_eStatus) ||
+               ((0 != memcmp(LOC_au8Read, LOC_au8Previous, TEST_RECORD_SIZE)) &&
+                (0 != memcmp(LOC_au8Read, LOC_au8New, TEST_RECORD_SIZE))) ||
+               ((LOC_u32Cut >= LOC_u32WriteTime) && (0 != memcmp(LOC_au8Read, LOC_au8New, TEST_RECORD_SIZE))))
+            {
+                LOC_u32Wrong++;
+            }else if(0 != memcmp(&Glob_sModel.au8Memory[TEST_RECORD_ADDRESS], LOC_au8Image + TEST_RECORD_ADDRESS,
+                                 EEPROM_RECORD_FOOTPRINT(TEST_RECORD_SIZE)) &&
+                     (0 == memcmp(LOC_au8Read, LOC_au8Previous, TEST_RECORD_SIZE))){
+
+                LOC_u32HalfWritten++;
+            }else{
+
+            }
+
+            /*The record is written again after the reboot*/
+            (void)MCAL_EEPROM_WriteRecord(&LOC_sRecord, LOC_au8Older);
+            (void)Model_Drain();
+            Model_Reboot();
+
+            HOST_TEST_CHECK("write after the cut", (E_OK == MCAL_EEPROM_ReadRecord(&LOC_sRecord, LOC_au8Read)) &&
+                                                   (0 == memcmp(LOC_au8Read, LOC_au8Older, TEST_RECORD_SIZE)));
+        }
+    }
+
+    HOST_TEST_CHECK("half written copies", LOC_u32HalfWritten > 0u);
+    HOST_TEST_CHECK("previous or new version", 0u == LOC_u32Wrong);
+    HOST_TEST_CHECK("register protocol", 0u == Glob_sModel.u32Violations);
+}
+
+/**************************************************************************************************************************
+===============================================
+*               Test entry
+*===============================================
+*/
+
+int main(void)
+{
+    Test_WriteQueueDrain();
+    Test_RecordVersions();
+    Test_PowerCutDuringRecordWrite();
+
+    return HOST_TEST_RESULT("EEPROM_Record_Test");
+}
@@ -0,0 +1,208 @@
+/**
+ * @file Gate_Throughput_Model.c
+ * 
+ * @brief Host model of the gate cycle comparing the old 500 ms PIR polling with the edge triggered passage
+ *  detection, it reports the vehicles per minute, how long the gate stays open after the car cleared the sensor
+ *  and how often the gate closes on a car because of a sensor dropout.
+ * 
+ * @note The cycle is the card and authentication time, the opening move, the passage and the closing move.
+ *  The cars and the sensor dropouts are drawn from a fixed seed so the figures are reproducible.
+ * 
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ * 
+ * @date 18-10-2026
+ * 
+ * @version 1.0
+ */
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include <stdio.h>
+#include <stdint.h>
+
+/** @defgroup Model parameters
+  * @{
+  */
+#define MODEL_VEHICLES                  100000UL
+#define MODEL_SEED                      1UL
+
+/*Time from the card tap until the gate starts opening*/
+#define MODEL_AUTH_TIME_MS              4000UL
+
+/*Time of one servo move, measured on the trapezoidal profile for 90 degrees*/
+#define MODEL_SERVO_MOVE_MS             380UL
+
+/*The car reaches the sensor 0 - 400 ms after the gate opened and occupies it for 1.5 - 3.5 s*/
+#define MODEL_ARRIVAL_MAX_MS            400UL
+#define MODEL_OCCUPIED_MIN_MS           1500UL
+#define MODEL_OCCUPIED_MAX_MS           3500UL
+
+/*Share of the passages where the sensor output drops for a moment in the middle of the car*/
+#define MODEL_DROPOUT_PERCENT           20UL
+#define MODEL_DROPOUT_MS                100UL
+
+/*Old firmware, the sensor was sampled every GATE_OPENED_TIME_MS*/
+#define MODEL_POLL_PERIOD_MS            500UL
+
+/*New firmware, same values as GATE_MIN_OPEN_TIME_MS and PASSAGE_CLEAR_HOLD_OFF_MS in Gate_Controller_Program.c*/
+#define MODEL_MIN_OPEN_TIME_MS          500UL
+#define MODEL_CLEAR_HOLD_OFF_MS         150UL
+/**
+  * @}
+  */
+
+/**
+ * @brief One passage, the times are in ms from the moment the gate is fully open.
+ * 
+ */
+typedef struct{
+    uint32_t u32ArriveMs;
+    uint32_t u32ClearMs;
+    uint32_t u32DropoutStartMs;         /*Equal to u32DropoutEndMs when there is no dropout*/
+    uint32_t u32DropoutEndMs;
+}sPassage_t;
+
+/**
+ * @brief The results of one detection method.
+ * 
+ */
+typedef struct{
+    const char* szName;
+    uint64_t u64CycleMs;                /*Sum of the cycle times*/
+    uint64_t u64OpenAfterClearMs;       /*Sum of the open times after the car cleared, for the passages not cut*/
+    uint32_t u32ClosedOnCar;            /*Passages where the gate closed before the car cleared the sensor*/
+}sMethodResult_t;
+
+static uint32_t Glob_u32Seed = MODEL_SEED;
+
+/**
+ * @brief This function returns a random number in [copy_u32Min, copy_u32Max].
+ * 
+ */
+static uint32_t Model_Random(uint32_t copy_u32Min, uint32_t copy_u32Max)
+{
+    Glob_u32Seed = (Glob_u32Seed * 1103515245UL) + 12345UL;
+
+    return copy_u32Min + ((Glob_u32Seed >> 8) % (copy_u32Max - copy_u32Min + 1UL));
+}
+
+/**
+ * @brief This function returns the PIR output at the given time.
+ * 
+ */
+static int Model_IsOccupied(const sPassage_t* ptr_sPassage, uint32_t copy_u32TimeMs)
+{
+    return (copy_u32TimeMs >= ptr_sPassage->u32ArriveMs) && (copy_u32TimeMs < ptr_sPassage->u32ClearMs) &&
+           !((copy_u32TimeMs >= ptr_sPassage->u32DropoutStartMs) && (copy_u32TimeMs < ptr_sPassage->u32DropoutEndMs));
+}
+
+/**
+ * @brief The old firmware closes at the first poll that sees the sensor clear.
+ * 
+ */
+static uint32_t Model_ClosePolling(const sPassage_t* ptr_sPassage)
+{
+    uint32_t LOC_u32TimeMs = MODEL_POLL_PERIOD_MS;
+
+    while(Model_IsOccupied(ptr_sPassage, LOC_u32TimeMs))
+    {
+        LOC_u32TimeMs += MODEL_POLL_PERIOD_MS;
+    }
+
+    return LOC_u32TimeMs;
+}
+
+/**
+ * @brief The new firmware closes once the sensor is clear, the minimum open time passed and the hold-off
+ *  passed since the last clearing edge, with a 1 ms resolution.
+ * 
+ */
+static uint32_t Model_CloseEdge(const sPassage_t* ptr_sPassage)
+{
+    uint32_t LOC_u32TimeMs = 0;
+    uint32_t LOC_u32LastClearMs = 0;
+    int LOC_iSeenClearEdge = 0;
+
+    while(Model_IsOccupied(ptr_sPassage, LOC_u32TimeMs) || (LOC_u32TimeMs < MODEL_MIN_OPEN_TIME_MS) ||
+          (LOC_iSeenClearEdge && (LOC_u32TimeMs < (LOC_u32LastClearMs + MODEL_CLEAR_HOLD_OFF_MS))))
+    {
+        LOC_u32TimeMs++;
+
+        if(Model_IsOccupied(ptr_sPassage, LOC_u32TimeMs - 1UL) && !Model_IsOccupied(ptr_sPassage, LOC_u32TimeMs))
+        {
+            LOC_u32LastClearMs = LOC_u32TimeMs;
+            LOC_iSeenClearEdge = 1;
+        }else{
+
+        }
+    }
+
+    return LOC_u32TimeMs;
+}
+
+/**
+ * @brief This function adds one passage to the results of a method.
+ * 
+ */
+static void Model_Account(sMethodResult_t* ptr_sResult, const sPassage_t* ptr_sPassage, uint32_t copy_u32CloseMs)
+{
+    if(copy_u32CloseMs < ptr_sPassage->u32ClearMs)
+    {
+        ptr_sResult->u32ClosedOnCar++;
+    }else{
+        ptr_sResult->u64OpenAfterClearMs += copy_u32CloseMs - ptr_sPassage->u32ClearMs;
+    }
+
+    ptr_sResult->u64CycleMs += MODEL_AUTH_TIME_MS + (2UL * MODEL_SERVO_MOVE_MS) + copy_u32CloseMs;
+}
+
+/**
+ * @brief This function prints the results of a method.
+ * 
+ */
+static void Model_Report(const sMethodResult_t* ptr_sResult)
+{
+    printf("%-16s %5.2f vehicles/min, open %3.0f ms after clear on average, %4.1f%% closed on the car\n",
+           ptr_sResult->szName,
+           (60000.0 * MODEL_VEHICLES) / (double)ptr_sResult->u64CycleMs,
+           (double)ptr_sResult->u64OpenAfterClearMs / (double)(MODEL_VEHICLES - ptr_sResult->u32ClosedOnCar),
+           (100.0 * ptr_sResult->u32ClosedOnCar) / MODEL_VEHICLES);
+}
+
+int main(void)
+{
+    sMethodResult_t LOC_sPolling = {"500 ms polling:", 0, 0, 0};
+    sMethodResult_t LOC_sEdge = {"edge + hold-off:", 0, 0, 0};
+    sPassage_t LOC_sPassage;
+    uint32_t LOC_u32Vehicle;
+
+    for(LOC_u32Vehicle = 0; LOC_u32Vehicle < MODEL_VEHICLES; LOC_u32Vehicle++)
+    {
+        LOC_sPassage.u32ArriveMs = Model_Random(0, MODEL_ARRIVAL_MAX_MS);
+        LOC_sPassage.u32ClearMs = LOC_sPassage.u32ArriveMs + Model_Random(MODEL_OCCUPIED_MIN_MS, MODEL_OCCUPIED_MAX_MS);
+
+        if(Model_Random(1, 100) <= MODEL_DROPOUT_PERCENT)
+        {
+            /*The dropout falls in the middle 30% - 70% of the passage*/
+            LOC_sPassage.u32DropoutStartMs = LOC_sPassage.u32ArriveMs +
+                (((LOC_sPassage.u32ClearMs - LOC_sPassage.u32ArriveMs) * Model_Random(30, 70)) / 100UL);
+            LOC_sPassage.u32DropoutEndMs = LOC_sPassage.u32DropoutStartMs + MODEL_DROPOUT_MS;
+        }else{
+            LOC_sPassage.u32DropoutStartMs = 0;
+            LOC_sPassage.u32DropoutEndMs = 0;
+        }
+
+        Model_Account(&LOC_sPolling, &LOC_sPassage, Model_ClosePolling(&LOC_sPassage));
+        Model_Account(&LOC_sEdge, &LOC_sPassage, Model_CloseEdge(&LOC_sPassage));
+    }
+
+    printf("%lu vehicles, %lu ms card and auth time, %lu ms servo moves\n",
+           MODEL_VEHICLES, MODEL_AUTH_TIME_MS, MODEL_SERVO_MOVE_MS);
+    Model_Report(&LOC_sPolling);
+    Model_Report(&LOC_sEdge);
+
+    return 0;
+}
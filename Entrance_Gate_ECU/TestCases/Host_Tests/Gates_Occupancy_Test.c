@@ -0,0 +1,363 @@
+/**
+ * @file Gates_Occupancy_Test.c
+ *
+ * @brief Host test of the occupancy the Main ECU pushes to the entrance gate. The garage is filled through the
+ *  gates links, the entrance gate must be told the garage is full once a driver waits for the next slot, and
+ *  told it's not full again once an exit approval let the waiting driver in or the driver gave up.
+ *
+ * @note The gates answer every SPI transaction right away, the sync with their address. The Platform_Types of the
+ *  Main ECU make uint32 64 bits wide on the host, the cycle counter of the model never wraps.
+ *
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ *
+ * @date 18-10-2026
+ *
+ * @version 1.0
+ */
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+/*The module translation unit is built in the test to reach its links and waiting list*/
+#include "Gates_Communication/Gates_Communication.c"
+#include "Host_Test.h"
+
+/** @defgroup Local Macros
+  * @{
+  */
+/*The Main ECU runs from the 8 MHz HSI*/
+#define MODEL_CYCLES_PER_MS         8000u
+
+/*Passes of the main loop to drain the pushes, every pass starts at most one frame per link*/
+#define MODEL_MAIN_LOOP_PASSES      8u
+
+#define MODEL_NO_OCCUPANCY          0xFFu
+#define MODEL_NO_RESULT             0x55u
+/**
+  * @}
+  */
+
+/**
+ * @brief Model of a gate ECU on its SPI link.
+ *
+ */
+typedef struct{
+    volatile SPI_Typedef* SPIx;
+    uint8 u8Address;
+    sSPI_Transaction_t* psPending;      /*Transaction submitted on the link and not exchanged yet*/
+    uint8 au8Request[GATE_REQUEST_HEADER_SIZE + AUTHORIZED_ID_SIZE];
+    uint8 u8CacheVersion;
+    uint8 u8LastResult;                 /*Code of the last result or reply frame received*/
+    uint8 u8Results;                    /*Result and reply frames received*/
+    uint8 u8Places;                     /*Places of the last occupancy push*/
+}sGateModel_t;
+
+static sGateModel_t Glob_sEntranceModel = {ENTRANCE_GATE_ECU_SPI, ENTRANCE_GATE_ECU_ADDRESS, NULL, {0}, 0, 0, 0, 0};
+static sGateModel_t Glob_sExitModel = {EXIT_GATE_ECU_SPI, EXIT_GATE_ECU_ADDRESS, NULL, {0}, 0, 0, 0, 0};
+
+static uint32 Glob_u32Cycles = 0;
+static uint8 Glob_u8Display = 0;
+
+/**************************************************************************************************************************
+===============================================
+*               Stubs of the Main ECU
+*===============================================
+*/
+void MCAL_SPI_Init(volatile SPI_Typedef* SPIx, SPI_Config_t* config)
+{
+    (void)SPIx;
+    (void)config;
+}
+
+eStatus_t MCAL_SPI_SubmitTransaction(volatile SPI_Typedef * SPIx, sSPI_Transaction_t* transaction)
+{
+    sGateModel_t* LOC_psGate = (SPIx == ENTRANCE_GATE_ECU_SPI)? &Glob_sEntranceModel : &Glob_sExitModel;
+
+    transaction->eStatus = SPI_TRANSACTION_PENDING;
+    LOC_psGate->psPending = transaction;
+
+    return E_OK;
+}
+
+void MCAL_EXTI_Enable(EXTI_config_t* EXTI_Config)
+{
+    (void)EXTI_Config;
+}
+
+void MCAL_NVIC_EnableIRQ(uint8 IRQn)
+{
+    (void)IRQn;
+}
+
+void MCAL_NVIC_DisableIRQ(uint8 IRQn)
+{
+    (void)IRQn;
+}
+
+void MCAL_NVIC_SetPriority(uint8 IRQn, uint8 priority)
+{
+    (void)IRQn;
+    (void)priority;
+}
+
+uint32 MCAL_NVIC_EnterCritical(void)
+{
+    return 0;
+}
+
+void MCAL_NVIC_ExitCritical(uint32 copy_u32PriMask)
+{
+    (void)copy_u32PriMask;
+}
+
+void MCAL_DWT_Init(void)
+{
+}
+
+uint32 MCAL_DWT_GetCycles(void)
+{
+    return Glob_u32Cycles;
+}
+
+uint32 MCAL_DWT_GetCyclesPerMs(void)
+{
+    return MODEL_CYCLES_PER_MS;
+}
+
+void HAL_SevenSeg_Init(void)
+{
+}
+
+void HAL_SevenSeg_DisplayNumber(uint8 copy_Number)
+{
+    Glob_u8Display = copy_Number;
+}
+
+void st_Admin_AuthenticateID(void)
+{
+}
+
+void AI_GC_SendIDForAuthentication(uint8* ptr_DriverID)
+{
+    (void)ptr_DriverID;
+}
+
+eStatus_t AI_GC_GetAuthorizedID(uint8 copy_u8Index, uint8* ptr_DriverID)
+{
+    (void)copy_u8Index;
+    (void)ptr_DriverID;
+
+    /*The gates caches are loaded with an empty list*/
+    return E_NOK;
+}
+
+uint8 AI_GC_LookupID(const uint8* ptr_DriverID)
+{
+    (void)ptr_DriverID;
+
+    return AI_LOOKUP_FOUND;
+}
+
+/**************************************************************************************************************************
+===============================================
+*               Gates model
+*===============================================
+*/
+
+/**
+ * @brief This function exchanges the transaction pending on the link of the gate.
+ *
+ * @param ptr_sGate : The gate model.
+ * @return int : 1 if a transaction was exchanged.
+ */
+static int Model_Exchange(sGateModel_t* ptr_sGate)
+{
+    sSPI_Transaction_t* LOC_psTransaction = ptr_sGate->psPending;
+
+    if(NULL == LOC_psTransaction)
+    {
+
+    }else if(1u == LOC_psTransaction->u16Length){
+
+        /*Sync byte, the gate answers with its address*/
+        *LOC_psTransaction->pu8RxBuffer = ptr_sGate->u8Address;
+
+    }else if(NULL != LOC_psTransaction->pu8RxBuffer){
+
+        memcpy(LOC_psTransaction->pu8RxBuffer, ptr_sGate->au8Request, LOC_psTransaction->u16Length);
+
+    }else if(GATE_CACHE_FRAME_SIZE == LOC_psTransaction->u16Length){
+
+        if(GATE_CACHE_OP_OCCUPANCY == LOC_psTransaction->pu8TxBuffer[GATE_CACHE_FRAME_OP_INDEX])
+        {
+            ptr_sGate->u8Places = LOC_psTransaction->pu8TxBuffer[GATE_CACHE_FRAME_ID_INDEX];
+
+        }else if(GATE_CACHE_OP_CLEAR == LOC_psTransaction->pu8TxBuffer[GATE_CACHE_FRAME_OP_INDEX]){
+
+            ptr_sGate->u8CacheVersion = LOC_psTransaction->pu8TxBuffer[GATE_CACHE_FRAME_VERSION_INDEX];
+        }else{
+
+        }
+    }else{
+        ptr_sGate->u8LastResult = LOC_psTransaction->pu8TxBuffer[GATE_RESULT_CODE_INDEX];
+        ptr_sGate->u8Results++;
+    }
+
+    /*The completion may submit the next transaction of the link*/
+    if(NULL != LOC_psTransaction)
+    {
+        ptr_sGate->psPending = NULL;
+        LOC_psTransaction->eStatus = SPI_TRANSACTION_DONE;
+        LOC_psTransaction->fptr_OnComplete();
+    }else{
+
+    }
+
+    return (NULL != LOC_psTransaction)? 1 : 0;
+}
+
+/**
+ * @brief This function exchanges the transactions of both links until they are quiet.
+ *
+ */
+static void Model_Run(void)
+{
+    while((Model_Exchange(&Glob_sEntranceModel) + Model_Exchange(&Glob_sExitModel)) > 0)
+    {
+    }
+}
+
+/**
+ * @brief This function runs the main loop of the Main ECU.
+ *
+ */
+static void Model_MainLoop(void)
+{
+    uint8 LOC_u8Pass;
+
+    for(LOC_u8Pass = 0; LOC_u8Pass < MODEL_MAIN_LOOP_PASSES; LOC_u8Pass++)
+    {
+        st_GatesComm_CheckPendingRequests();
+        Model_Run();
+    }
+}
+
+/**
+ * @brief This function lets the time pass on the cycle counter.
+ *
+ * @param copy_u32TimeMs : Time in ms.
+ */
+static void Model_Wait(uint32 copy_u32TimeMs)
+{
+    Glob_u32Cycles += copy_u32TimeMs * MODEL_CYCLES_PER_MS;
+}
+
+/**
+ * @brief This function sends a request from the gate and lets the Main ECU handle it.
+ *
+ * @param ptr_sGate : The gate model.
+ * @param copy_u8Type : The request type.
+ * @param copy_u8Driver : The driver, the ID is made of it.
+ */
+static void Model_GateRequest(sGateModel_t* ptr_sGate, uint8 copy_u8Type, uint8 copy_u8Driver)
+{
+    ptr_sGate->au8Request[GATE_REQUEST_TYPE_INDEX] = copy_u8Type;
+    ptr_sGate->au8Request[GATE_REQUEST_VERSION_INDEX] = ptr_sGate->u8CacheVersion;
+    memset(&ptr_sGate->au8Request[GATE_REQUEST_HEADER_SIZE], copy_u8Driver, AUTHORIZED_ID_SIZE);
+    ptr_sGate->u8LastResult = MODEL_NO_RESULT;
+
+    if(ptr_sGate == &Glob_sEntranceModel)
+    {
+        EXTI_Line4_ISR_Callback();
+    }else{
+        EXTI_Line12_ISR_Callback();
+    }
+
+    Model_Run();
+    Model_MainLoop();
+}
+
+/**************************************************************************************************************************
+===============================================
+*               Tests
+*===============================================
+*/
+
+/**
+ * @brief The garage is full for the entrance gate only while a driver waits for the next slot, the exit
+ * approval that frees the slot admits the driver and the gate is told it's not full once the entry is
+ * notified.
+ *
+ */
+static void Test_ExitApprovalClearsFull(void)
+{
+    uint8 LOC_u8Driver;
+    uint8 LOC_u8Results;
+
+    Glob_sEntranceModel.u8Places = MODEL_NO_OCCUPANCY;
+
+    for(LOC_u8Driver = 1; LOC_u8Driver <= NUMBER_OF_GARAGE_SLOTS; LOC_u8Driver++)
+    {
+        Model_GateRequest(&Glob_sEntranceModel, GATE_REQUEST_AUTHENTICATE, LOC_u8Driver);
+        HOST_TEST_CHECK("entry", Glob_sEntranceModel.u8LastResult == AUTHENTICATION_RESULT_PASS);
+    }
+
+    HOST_TEST_CHECK("garage filled", (GatesComm_SlotsLeft() == 0) && (Glob_u8Display == 0));
+
+    /*The next driver can still wait for a slot*/
+    HOST_TEST_CHECK("no slot left", (Glob_sEntranceModel.u8Places != MODEL_NO_OCCUPANCY) &&
+                                    (Glob_sEntranceModel.u8Places > 0));
+
+    Model_GateRequest(&Glob_sEntranceModel, GATE_REQUEST_AUTHENTICATE, LOC_u8Driver);
+    HOST_TEST_CHECK("waiting driver", Glob_sEntranceModel.u8LastResult == GATE_REPLY_WAITLISTED);
+    HOST_TEST_CHECK("full pushed", Glob_sEntranceModel.u8Places == 0);
+
+    /*An exit frees the slot, it's kept for the waiting driver*/
+    Model_GateRequest(&Glob_sExitModel, GATE_REQUEST_AUTHENTICATE, 1);
+    HOST_TEST_CHECK("exit", Glob_sExitModel.u8LastResult == AUTHENTICATION_RESULT_PASS);
+    HOST_TEST_CHECK("admission", Glob_sEntranceModel.u8LastResult == GATE_REPLY_ADMITTED);
+    HOST_TEST_CHECK("slot kept", Glob_sEntranceModel.u8Places == 0);
+
+    /*The admission is sent again until the gate notifies the entry*/
+    LOC_u8Results = Glob_sEntranceModel.u8Results;
+    Model_Wait(GATE_ADMISSION_RETRY_MS);
+    Model_MainLoop();
+    HOST_TEST_CHECK("admission resent", (Glob_sEntranceModel.u8Results == (uint8)(LOC_u8Results + 1u)) &&
+                                        (Glob_sEntranceModel.u8LastResult == GATE_REPLY_ADMITTED));
+
+    Model_GateRequest(&Glob_sEntranceModel, GATE_REQUEST_ENTRY_NOTIFY, LOC_u8Driver);
+    HOST_TEST_CHECK("admitted", (GatesComm_WaitlistCount() == 0) && (GatesComm_SlotsLeft() == 0) &&
+                                (Glob_u8Display == 0));
+    HOST_TEST_CHECK("not full pushed", Glob_sEntranceModel.u8Places > 0);
+}
+
+/**
+ * @brief A driver the gate gave up on leaves the waiting list and the gate is told it's not full.
+ *
+ */
+static void Test_GivenUpDriverClearsFull(void)
+{
+    Model_GateRequest(&Glob_sEntranceModel, GATE_REQUEST_AUTHENTICATE, 0x20);
+    HOST_TEST_CHECK("waiting driver", Glob_sEntranceModel.u8LastResult == GATE_REPLY_WAITLISTED);
+    HOST_TEST_CHECK("full pushed", Glob_sEntranceModel.u8Places == 0);
+
+    Model_Wait(GATE_WAITLIST_TIMEOUT_MS - 1u);
+    Model_MainLoop();
+    HOST_TEST_CHECK("still waiting", (GatesComm_WaitlistCount() == 1) && (Glob_sEntranceModel.u8Places == 0));
+
+    Model_Wait(1u);
+    Model_MainLoop();
+    HOST_TEST_CHECK("expired", (GatesComm_WaitlistCount() == 0) && (Glob_sEntranceModel.u8Places > 0));
+}
+
+int main(void)
+{
+    st_GatesComm_Init();
+
+    Test_ExitApprovalClearsFull();
+    Test_GivenUpDriverClearsFull();
+
+    return HOST_TEST_RESULT("Gates_Occupancy_Test");
+}
@@ -0,0 +1,79 @@
+/**
+ * @file Atmega32.h
+ * 
+ * @brief Host replacement of the Atmega32 device header for the drivers tested on the host, the registers
+ *  are routed to the host models of the tests instead of the memory mapped IO.
+ * 
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ * 
+ * @date 18-10-2026
+ * 
+ * @version 1.0
+ */
+
+#ifndef ATMEGA32_H_
+#define ATMEGA32_H_
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Bit_Math.h"
+#include "Platform_Types.h"
+
+#ifndef F_CPU
+#define F_CPU    8000000u
+#endif
+
+/*================================================================*/
+/*The status register only holds the global interrupt flag on the host*/
+extern volatile uint8_t Host_u8SREG;
+
+#define SREG    Host_u8SREG
+
+/*================================================================*/
+//-*-*-*-*-*-*-*-*-*-*-*-
+//Peripheral registers:
+//-*-*-*-*-*-*-*-*-*-*-*-
+
+typedef struct{
+    vuint8_t  EECR;                 /*EEPROM Control Register*/
+    vuint8_t  EEDR;                 /*EEPROM Data Register*/
+    vuint16_t EEAR;                 /*EEPROM Address Register*/
+}EEPROM_typedef;
+
+/**
+ * @brief Gives the EEPROM registers of the host model, the model first acts on what the driver wrote to them
+ *  since the last access (a read strobe, a write strobe) and advances its clock by one register access.
+ */
+EEPROM_typedef* Host_EEPROM_Access(void);
+
+/*-----------------EEPROM------------------------*/
+#define EEPROM  (Host_EEPROM_Access())
+
+/*================================================================*/
+//-*-*-*-*-*-*-*-*-*-*-*-
+//Generic Macros:
+//-*-*-*-*-*-*-*-*-*-*-*
+#define G_INTERRUPT_ENABLE      SREG |= (1 << 7);
+#define G_INTERRUPT_DISABLE     SREG &= ~(1 << 7);
+
+/*---------------------EEPROM------------------------*/
+
+/** @defgroup EECR
+  * @{
+  */
+#define EEPROM_EECR_EERE_POS             0
+#define EEPROM_EECR_EERE_MASK            (1 << EEPROM_EECR_EERE_POS)    /*!< EEPROM Read Enable*/
+#define EEPROM_EECR_EEWE_POS             1
+#define EEPROM_EECR_EEWE_MASK            (1 << EEPROM_EECR_EEWE_POS)    /*!< EEPROM Write Enable*/
+#define EEPROM_EECR_EEMWE_POS            2
+#define EEPROM_EECR_EEMWE_MASK           (1 << EEPROM_EECR_EEMWE_POS)   /*!< EEPROM Master Write Enable*/
+#define EEPROM_EECR_EERIE_POS            3
+#define EEPROM_EECR_EERIE_MASK           (1 << EEPROM_EECR_EERIE_POS)   /*!< EEPROM Ready Interrupt Enable*/
+/**
+  * @}
+  */
+
+#endif /* ATMEGA32_H_ */
@@ -0,0 +1,46 @@
+/**
+ * @file Host_Test.h
+ * 
+ * @brief This file contains the checks shared by the host tests of the gate ECU drivers that don't depend
+ *  on the hardware.
+ * 
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ * 
+ * @date 18-10-2026
+ * 
+ * @version 1.0
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Number of failed checks of the test program.
+ * 
+ */
+static unsigned int Glob_uHostTestFailures = 0;
+
+/*Report a failed check with its location and keep going*/
+#define HOST_TEST_CHECK(NAME, COND)                                                         \
+    do{                                                                                     \
+        if(!(COND))                                                                         \
+        {                                                                                   \
+            printf("%s:%d: %s: check failed: %s\n", __FILE__, __LINE__, (NAME), #COND);    \
+            Glob_uHostTestFailures++;                                                       \
+        }                                                                                   \
+    }while(0)
+
+/*Print the summary and give the exit code of the test program*/
+#define HOST_TEST_RESULT(NAME)                                                              \
+    (printf("%s: %s\n", (NAME), (0u == Glob_uHostTestFailures)? "PASS" : "FAIL"),         \
+     (0u == Glob_uHostTestFailures)? 0 : 1)
+
+#endif /* HOST_TEST_H_ */
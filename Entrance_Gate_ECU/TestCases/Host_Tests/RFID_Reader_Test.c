@@ -0,0 +1,289 @@
+/**
+ * @file RFID_Reader_Test.c
+ * 
+ * @brief Host replay and fuzz test of the HAL RFID reader frame parser, the parser has no hardware dependency
+ *  so it's built here with the host compiler and fed recorded reader streams, noise and random bytes.
+ * 
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ * 
+ * @date 18-10-2026
+ * 
+ * @version 1.0
+ */
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "RFID_Reader_Driver/RFID_Reader_Interface.h"
+#include "Host_Test.h"
+
+/** @defgroup Local Macros
+  * @{
+  */
+#define FUZZ_STREAM_SIZE            20000u
+#define FUZZ_SEED                   0x1234ABCDu
+
+/*A frame is STX, the tag, 2 checksum characters and ETX*/
+#define RFID_FRAME_SIZE             (RFID_TAG_SIZE + 4u)
+/**
+  * @}
+  */
+
+/**
+ * @brief A byte stream recorded from a reader and what the parser must report for it.
+ * 
+ */
+typedef struct{
+    const char* szName;
+    const uint8_t* pu8Stream;
+    uint16_t u16Length;
+    uint8_t u8Frames;                   /*Number of valid frames in the stream*/
+    const char* szLastTag;              /*Tag of the last valid frame, NULL if there is none*/
+    uint16_t u16Errors;                 /*Number of frames the parser must drop*/
+}sRecordedStream_t;
+
+/** @defgroup Recorded streams
+  * @{
+  */
+/*Two taps of the same card as sent by an RDM6300*/
+static const uint8_t Glob_au8TwoTaps[] = {
+    0x02, '1','F','0','0','E','4','A','7','C','2', '9','E', 0x03,
+    0x02, '1','F','0','0','E','4','A','7','C','2', '9','E', 0x03
+};
+
+/*Power up garbage, then a frame with lower case hex characters*/
+static const uint8_t Glob_au8Garbage[] = {
+    0xFF, 0x00, 0x7E, 'Z', 0x03, 0x80, 0xC3,
+    0x02, '0','4','0','0','6','b','2','f','9','1', 'd','1', 0x03
+};
+
+/*A frame with a corrupted checksum followed by a good one*/
+static const uint8_t Glob_au8BadChecksum[] = {
+    0x02, '6','2','E','3','0','8','6','C','E','D', '0','9', 0x03,
+    0x02, '6','2','E','3','0','8','6','C','E','D', '0','8', 0x03
+};
+
+/*A frame cut by a new STX (the reader restarted), a non hex character and a missing ETX*/
+static const uint8_t Glob_au8CutFrames[] = {
+    0x02, '6','2','E','3','0',
+    0x02, '1','F','0','0','E','G','A','7','C','2', '9','E', 0x03,
+    0x02, '1','F','0','0','E','4','A','7','C','2', '9','E', 0x0D,
+    0x02, '6','2','E','3','0','8','6','C','E','D', '0','8', 0x03
+};
+/**
+  * @}
+  */
+
+static const sRecordedStream_t Glob_asStreams[] = {
+    {"two taps",      Glob_au8TwoTaps,      sizeof(Glob_au8TwoTaps),      2, "1F00E4A7C2", 0},
+    {"garbage",       Glob_au8Garbage,      sizeof(Glob_au8Garbage),      1, "04006b2f91", 0},
+    {"bad checksum",  Glob_au8BadChecksum,  sizeof(Glob_au8BadChecksum),  1, "62E3086CED", 1},
+    {"cut frames",    Glob_au8CutFrames,    sizeof(Glob_au8CutFrames),    1, "62E3086CED", 3},
+};
+
+/**************************************************************************************************************************
+===============================================
+*               Private Functions
+*===============================================
+*/
+
+/**
+ * @brief This function returns the value of an ASCII hex character, 0xFF if it's not one.
+ * 
+ */
+static uint8_t Test_HexValue(uint8_t copy_u8Char)
+{
+    uint8_t LOC_u8Value = 0xFFu;
+
+    if((copy_u8Char >= '0') && (copy_u8Char <= '9'))
+    {
+        LOC_u8Value = copy_u8Char - '0';
+    }else if((copy_u8Char >= 'A') && (copy_u8Char <= 'F')){
+        LOC_u8Value = copy_u8Char - 'A' + 10u;
+    }else if((copy_u8Char >= 'a') && (copy_u8Char <= 'f')){
+        LOC_u8Value = copy_u8Char - 'a' + 10u;
+    }else{
+
+    }
+
+    return LOC_u8Value;
+}
+
+/**
+ * @brief This function checks that the RFID_FRAME_SIZE bytes ending at the given byte are a valid frame,
+ *  the reference the parser is checked against.
+ * 
+ */
+static boolean Test_IsValidFrame(const uint8_t* ptr_u8FrameEnd)
+{
+    const uint8_t* LOC_pu8Frame = ptr_u8FrameEnd - (RFID_FRAME_SIZE - 1u);
+    uint8_t LOC_u8Checksum = 0;
+    uint8_t LOC_u8Index;
+    boolean LOC_boolValid = ((LOC_pu8Frame[0] == RFID_FRAME_STX) && (*ptr_u8FrameEnd == RFID_FRAME_ETX))? TRUE : FALSE;
+
+    for(LOC_u8Index = 1; (LOC_u8Index < (RFID_FRAME_SIZE - 1u)) && (TRUE == LOC_boolValid); LOC_u8Index++)
+    {
+        LOC_boolValid = (Test_HexValue(LOC_pu8Frame[LOC_u8Index]) != 0xFFu)? TRUE : FALSE;
+    }
+
+    for(LOC_u8Index = 1; (LOC_u8Index < (RFID_FRAME_SIZE - 1u)) && (TRUE == LOC_boolValid); LOC_u8Index += 2u)
+    {
+        LOC_u8Checksum ^= (uint8_t)((Test_HexValue(LOC_pu8Frame[LOC_u8Index]) << 4) | Test_HexValue(LOC_pu8Frame[LOC_u8Index + 1u]));
+    }
+
+    /*The checksum byte XOR-ed with the tag bytes gives zero*/
+    return ((TRUE == LOC_boolValid) && (0u == LOC_u8Checksum))? TRUE : FALSE;
+}
+
+/**
+ * @brief This function replays the recorded streams and checks the frames, tags and errors reported.
+ * 
+ */
+static void Test_ReplayRecordedStreams(void)
+{
+    uint8_t LOC_u8Stream;
+    uint16_t LOC_u16Index;
+    uint8_t LOC_u8Frames;
+    uint16_t LOC_u16Errors;
+    const sRecordedStream_t* LOC_psStream;
+
+    for(LOC_u8Stream = 0; LOC_u8Stream < (sizeof(Glob_asStreams) / sizeof(Glob_asStreams[0])); LOC_u8Stream++)
+    {
+        LOC_psStream = &Glob_asStreams[LOC_u8Stream];
+        LOC_u8Frames = 0;
+        LOC_u16Errors = HAL_RFID_GetErrorCount();
+
+        HAL_RFID_Reset();
+
+        for(LOC_u16Index = 0; LOC_u16Index < LOC_psStream->u16Length; LOC_u16Index++)
+        {
+            if(RFID_FrameComplete == HAL_RFID_ParseByte(LOC_psStream->pu8Stream[LOC_u16Index]))
+            {
+                LOC_u8Frames++;
+            }else{
+
+            }
+        }
+
+        HOST_TEST_CHECK(LOC_psStream->szName, LOC_u8Frames == LOC_psStream->u8Frames);
+        HOST_TEST_CHECK(LOC_psStream->szName, (HAL_RFID_GetErrorCount() - LOC_u16Errors) == LOC_psStream->u16Errors);
+        HOST_TEST_CHECK(LOC_psStream->szName, 0 == strcmp((const char*)HAL_RFID_GetTag(), LOC_psStream->szLastTag));
+    }
+}
+
+/**
+ * @brief This function checks that the tag handed out stays untouched while the next frame is received.
+ * 
+ */
+static void Test_TagKeptDuringNextFrame(void)
+{
+    const uint8_t* LOC_pu8Tag;
+    uint16_t LOC_u16Index;
+
+    HAL_RFID_Reset();
+
+    for(LOC_u16Index = 0; LOC_u16Index < RFID_FRAME_SIZE; LOC_u16Index++)
+    {
+        (void)HAL_RFID_ParseByte(Glob_au8BadChecksum[RFID_FRAME_SIZE + LOC_u16Index]);
+    }
+
+    LOC_pu8Tag = HAL_RFID_GetTag();
+
+    /*Everything but the ETX of the next frame*/
+    for(LOC_u16Index = 0; LOC_u16Index < (RFID_FRAME_SIZE - 1u); LOC_u16Index++)
+    {
+        (void)HAL_RFID_ParseByte(Glob_au8TwoTaps[LOC_u16Index]);
+    }
+
+    HOST_TEST_CHECK("tag kept", 0 == strcmp((const char*)LOC_pu8Tag, "62E3086CED"));
+
+    (void)HAL_RFID_ParseByte(RFID_FRAME_ETX);
+
+    HOST_TEST_CHECK("tag swapped", 0 == strcmp((const char*)HAL_RFID_GetTag(), "1F00E4A7C2"));
+}
+
+/**
+ * @brief This function feeds random bytes mixed with frame characters and valid frames, every frame the parser
+ *  accepts must be a valid one and every valid frame must be accepted.
+ * 
+ */
+static void Test_FuzzStream(void)
+{
+    static uint8_t LOC_au8Stream[FUZZ_STREAM_SIZE];
+    static const uint8_t LOC_au8Alphabet[] = {RFID_FRAME_STX, RFID_FRAME_ETX, '0', '9', 'A', 'F', 'a', 'f', 'G', 0x00, 0xFF};
+    uint32_t LOC_u32Seed = FUZZ_SEED;
+    uint32_t LOC_u32Index = 0;
+    uint32_t LOC_u32Expected = 0;
+    uint32_t LOC_u32Accepted = 0;
+    uint32_t LOC_u32Wrong = 0;
+    uint8_t LOC_u8Byte;
+
+    while(LOC_u32Index < FUZZ_STREAM_SIZE)
+    {
+        LOC_u32Seed = (LOC_u32Seed * 1103515245u) + 12345u;
+        LOC_u8Byte = (uint8_t)(LOC_u32Seed >> 16);
+
+        if(((LOC_u8Byte & 0x0Fu) == 0u) && ((LOC_u32Index + sizeof(Glob_au8TwoTaps)) <= FUZZ_STREAM_SIZE))
+        {
+            /*Drop a recorded valid frame in the noise*/
+            memcpy(&LOC_au8Stream[LOC_u32Index], &Glob_au8BadChecksum[RFID_FRAME_SIZE], RFID_FRAME_SIZE);
+            LOC_u32Index += RFID_FRAME_SIZE;
+
+        }else if(LOC_u8Byte & 0x80u){
+
+            LOC_au8Stream[LOC_u32Index] = LOC_au8Alphabet[LOC_u8Byte % sizeof(LOC_au8Alphabet)];
+            LOC_u32Index++;
+        }else{
+            LOC_au8Stream[LOC_u32Index] = (uint8_t)(LOC_u32Seed >> 24);
+            LOC_u32Index++;
+        }
+    }
+
+    HAL_RFID_Reset();
+
+    for(LOC_u32Index = 0; LOC_u32Index < FUZZ_STREAM_SIZE; LOC_u32Index++)
+    {
+        if((LOC_u32Index >= (RFID_FRAME_SIZE - 1u)) && (TRUE == Test_IsValidFrame(&LOC_au8Stream[LOC_u32Index])))
+        {
+            LOC_u32Expected++;
+        }else{
+
+        }
+
+        if(RFID_FrameComplete == HAL_RFID_ParseByte(LOC_au8Stream[LOC_u32Index]))
+        {
+            LOC_u32Accepted++;
+
+            if((LOC_u32Index < (RFID_FRAME_SIZE - 1u)) || (FALSE == Test_IsValidFrame(&LOC_au8Stream[LOC_u32Index])) ||
+               (0 != memcmp(HAL_RFID_GetTag(), &LOC_au8Stream[LOC_u32Index - (RFID_FRAME_SIZE - 2u)], RFID_TAG_SIZE)))
+            {
+                LOC_u32Wrong++;
+            }else{
+
+            }
+        }else{
+
+        }
+    }
+
+    HOST_TEST_CHECK("fuzz has frames", LOC_u32Expected > 0u);
+    HOST_TEST_CHECK("fuzz accepts only valid frames", 0u == LOC_u32Wrong);
+    HOST_TEST_CHECK("fuzz accepts every valid frame", LOC_u32Accepted == LOC_u32Expected);
+}
+
+/**************************************************************************************************************************
+===============================================
+*               Test entry
+*===============================================
+*/
+
+int main(void)
+{
+    Test_ReplayRecordedStreams();
+    Test_TagKeptDuringNextFrame();
+    Test_FuzzStream();
+
+    return HOST_TEST_RESULT("RFID_Reader_Test");
+}
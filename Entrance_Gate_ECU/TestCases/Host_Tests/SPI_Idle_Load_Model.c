@@ -0,0 +1,349 @@
+/**
+ * @file SPI_Idle_Load_Model.c
+ *
+ * @brief Host model of the Main ECU SPI links while both gates are idle, comparing the old handler that kept
+ *  TXEIE enabled with the RXNE driven transaction engine, it reports the interrupts per second of each link and
+ *  the core cycles per second spent in them.
+ *
+ * @note The model steps the transmit buffer and the shift register of SPI1 and SPI2 on the core clock and runs
+ *  one handler at a time, the pending one with the highest priority first. Preemption and the wait states of the
+ *  bus are not modelled. The handler body is an estimate, it's swept over a few values.
+ *
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ *
+ * @date 18-10-2026
+ *
+ * @version 1.0
+ */
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include <stdio.h>
+#include <stdint.h>
+
+/** @defgroup Model parameters
+  * @{
+  */
+/*8 MHz HSI without the PLL, both APB buses run at the core clock*/
+#define MODEL_CORE_HZ                   8000000UL
+
+/*SPI_BAUD_RATE_PRESCALER_8 and 8 bit frames*/
+#define MODEL_SPI_PRESCALER             8UL
+#define MODEL_FRAME_BITS                8UL
+#define MODEL_FRAME_CYCLES              (MODEL_SPI_PRESCALER * MODEL_FRAME_BITS)
+
+/*Cortex-M3 exception entry, return and tail-chaining with zero wait states*/
+#define MODEL_IRQ_ENTRY_CYCLES          12UL
+#define MODEL_IRQ_EXIT_CYCLES           10UL
+#define MODEL_IRQ_TAIL_CHAIN_CYCLES     6UL
+
+/*Flag checks of SPIx_IRQHandler, the call of the callback and the callback with its receive and send calls*/
+#define MODEL_HANDLER_BODY_CYCLES       {20UL, 40UL, 80UL}
+#define MODEL_HANDLER_BODY_POINTS       3
+
+/*Same values as ENTRANCE_GATE_ECU_ADDRESS and EXIT_GATE_ECU_ADDRESS in Gates_Communication.c*/
+#define MODEL_ENTRANCE_GATE_ADDRESS     0xE7u
+#define MODEL_EXIT_GATE_ADDRESS         0x7Eu
+
+/*An idle gate doesn't acknowledge, the master reads back the line level*/
+#define MODEL_IDLE_RX_FRAME             0x00u
+
+#define MODEL_LINKS                     2
+#define MODEL_NO_LINK                   (-1)
+/**
+  * @}
+  */
+
+/**
+ * @brief The designs being compared.
+ *
+ */
+typedef enum{
+    MODEL_OLD_TXE_HANDLER,
+    MODEL_RXNE_ENGINE
+}eDesign_t;
+
+/**
+ * @brief One SPI instance and the state of the old callback using it.
+ *
+ */
+typedef struct{
+    const char* szName;
+    uint8_t u8GateAddress;
+    uint8_t u8Priority;                 /*Lower is more urgent, as in the NVIC*/
+
+    /*Peripheral*/
+    int iTxBufferFull;                  /*TXE is the complement*/
+    uint64_t u64ShiftEnd;               /*0 when the shift register is idle*/
+    int iTXEIE;
+    int iRXNEIE;
+    int iRXNE;
+
+    /*Static variables of the old callback*/
+    uint8_t u8TransmitCounter;
+    uint8_t u8FailedTransmissionCounter;
+
+    /*Pending transactions of the engine*/
+    uint8_t u8QueueCount;
+
+    /*Results*/
+    uint64_t u64Interrupts;
+    uint64_t u64Cycles;
+}sLink_t;
+
+/**
+ * @brief This function moves the shift register and the transmit buffer of a link up to the given time.
+ *
+ */
+static void Model_StepLink(sLink_t* ptr_sLink, uint64_t copy_u64Now)
+{
+    while((ptr_sLink->u64ShiftEnd != 0) && (ptr_sLink->u64ShiftEnd <= copy_u64Now))
+    {
+        ptr_sLink->iRXNE = 1;
+
+        if(ptr_sLink->iTxBufferFull)
+        {
+            ptr_sLink->iTxBufferFull = 0;
+            ptr_sLink->u64ShiftEnd += MODEL_FRAME_CYCLES;
+        }else{
+            ptr_sLink->u64ShiftEnd = 0;
+        }
+    }
+}
+
+/**
+ * @brief This function writes a frame to DR, it goes straight to the shift register if it's idle.
+ *
+ */
+static void Model_WriteDR(sLink_t* ptr_sLink, uint64_t copy_u64Now)
+{
+    if(ptr_sLink->u64ShiftEnd == 0)
+    {
+        ptr_sLink->u64ShiftEnd = copy_u64Now + MODEL_FRAME_CYCLES;
+    }else{
+        ptr_sLink->iTxBufferFull = 1;
+    }
+}
+
+/**
+ * @brief The old callback, ENTRANCE_GATE_ECU_SPI_TXEmpty_ISR_Callback and its exit gate twin.
+ *
+ */
+static void Model_OldTxeCallback(sLink_t* ptr_sLink, uint64_t copy_u64Now)
+{
+    uint8_t LOC_u8Received;
+
+    /*MCAL_SPI_ReceiveData*/
+    LOC_u8Received = MODEL_IDLE_RX_FRAME;
+    ptr_sLink->iRXNE = 0;
+
+    if(ptr_sLink->u8TransmitCounter == 0)
+    {
+        if(LOC_u8Received != ptr_sLink->u8GateAddress)
+        {
+            ptr_sLink->u8FailedTransmissionCounter++;
+            ptr_sLink->u8TransmitCounter--;
+        }else{
+
+        }
+    }else{
+
+    }
+
+    ptr_sLink->u8TransmitCounter++;
+
+    if((ptr_sLink->u8TransmitCounter == 4) || (ptr_sLink->u8FailedTransmissionCounter == 10))
+    {
+        ptr_sLink->u8TransmitCounter = 0;
+    }else{
+        /*MCAL_SPI_SendData of the dummy frame*/
+        Model_WriteDR(ptr_sLink, copy_u64Now);
+    }
+}
+
+/**
+ * @brief This function returns the pending link with the highest priority.
+ *
+ */
+static int Model_PendingLink(sLink_t* ptr_sLinks)
+{
+    int LOC_iLink;
+    int LOC_iPending = MODEL_NO_LINK;
+
+    for(LOC_iLink = 0; LOC_iLink < MODEL_LINKS; LOC_iLink++)
+    {
+        if((ptr_sLinks[LOC_iLink].iTXEIE && !ptr_sLinks[LOC_iLink].iTxBufferFull) ||
+           (ptr_sLinks[LOC_iLink].iRXNEIE && ptr_sLinks[LOC_iLink].iRXNE))
+        {
+            if((LOC_iPending == MODEL_NO_LINK) ||
+               (ptr_sLinks[LOC_iLink].u8Priority < ptr_sLinks[LOC_iPending].u8Priority))
+            {
+                LOC_iPending = LOC_iLink;
+            }else{
+
+            }
+        }else{
+
+        }
+    }
+
+    return LOC_iPending;
+}
+
+/**
+ * @brief This function returns the next time a TXE flag rises, the end of the run if there is none.
+ *
+ */
+static uint64_t Model_NextEvent(const sLink_t* ptr_sLinks, uint64_t copy_u64End)
+{
+    int LOC_iLink;
+    uint64_t LOC_u64Next = copy_u64End;
+
+    for(LOC_iLink = 0; LOC_iLink < MODEL_LINKS; LOC_iLink++)
+    {
+        if((ptr_sLinks[LOC_iLink].u64ShiftEnd != 0) && (ptr_sLinks[LOC_iLink].u64ShiftEnd < LOC_u64Next))
+        {
+            LOC_u64Next = ptr_sLinks[LOC_iLink].u64ShiftEnd;
+        }else{
+
+        }
+    }
+
+    return LOC_u64Next;
+}
+
+/**
+ * @brief This function runs both links idle for one second and returns the cycles left to the main loop.
+ *
+ */
+static uint64_t Model_Run(sLink_t* ptr_sLinks, eDesign_t copy_eDesign, uint64_t copy_u64BodyCycles)
+{
+    int LOC_iLink;
+    int LOC_iStepped;
+    int LOC_iTailChain = 0;
+    uint64_t LOC_u64Now = 0;
+    uint64_t LOC_u64Start;
+    uint64_t LOC_u64ThreadCycles = 0;
+
+    for(LOC_iLink = 0; LOC_iLink < MODEL_LINKS; LOC_iLink++)
+    {
+        if(copy_eDesign == MODEL_OLD_TXE_HANDLER)
+        {
+            /*SPI_Init enabled TXEIE for good*/
+            ptr_sLinks[LOC_iLink].iTXEIE = 1;
+        }else{
+            /*The engine enables RXNEIE only while a transaction is in flight*/
+            ptr_sLinks[LOC_iLink].iRXNEIE = (ptr_sLinks[LOC_iLink].u8QueueCount > 0);
+        }
+    }
+
+    while(LOC_u64Now < MODEL_CORE_HZ)
+    {
+        for(LOC_iLink = 0; LOC_iLink < MODEL_LINKS; LOC_iLink++)
+        {
+            Model_StepLink(&ptr_sLinks[LOC_iLink], LOC_u64Now);
+        }
+
+        LOC_iLink = Model_PendingLink(ptr_sLinks);
+
+        if(LOC_iLink == MODEL_NO_LINK)
+        {
+            if(LOC_iTailChain)
+            {
+                LOC_u64Now += MODEL_IRQ_EXIT_CYCLES;
+                LOC_iTailChain = 0;
+            }else{
+                /*Thread mode until the next flag rises*/
+                LOC_u64Start = LOC_u64Now;
+                LOC_u64Now = Model_NextEvent(ptr_sLinks, MODEL_CORE_HZ);
+                LOC_u64ThreadCycles += LOC_u64Now - LOC_u64Start;
+            }
+        }else{
+            LOC_u64Start = LOC_u64Now;
+            LOC_u64Now += (LOC_iTailChain)? MODEL_IRQ_TAIL_CHAIN_CYCLES : MODEL_IRQ_ENTRY_CYCLES;
+            LOC_u64Now += copy_u64BodyCycles;
+
+            for(LOC_iStepped = 0; LOC_iStepped < MODEL_LINKS; LOC_iStepped++)
+            {
+                Model_StepLink(&ptr_sLinks[LOC_iStepped], LOC_u64Now);
+            }
+
+            /*Only the old handler can be pending, the engine has nothing in flight*/
+            Model_OldTxeCallback(&ptr_sLinks[LOC_iLink], LOC_u64Now);
+
+            ptr_sLinks[LOC_iLink].u64Interrupts++;
+            ptr_sLinks[LOC_iLink].u64Cycles += LOC_u64Now - LOC_u64Start;
+
+            /*The exit is charged to the handler that ends the chain*/
+            if(Model_PendingLink(ptr_sLinks) == MODEL_NO_LINK)
+            {
+                ptr_sLinks[LOC_iLink].u64Cycles += MODEL_IRQ_EXIT_CYCLES;
+            }else{
+
+            }
+
+            LOC_iTailChain = 1;
+        }
+    }
+
+    return LOC_u64ThreadCycles;
+}
+
+/**
+ * @brief This function prints the results of one run.
+ *
+ */
+static void Model_Report(const char* szDesign, const sLink_t* ptr_sLinks, uint64_t copy_u64ThreadCycles)
+{
+    uint64_t LOC_u64Cycles = ptr_sLinks[0].u64Cycles + ptr_sLinks[1].u64Cycles;
+
+    printf("%-26s %s %6llu IRQs/s, %s %6llu IRQs/s, %7llu cycles/s in the handlers, %7llu left to the main loop\n",
+           szDesign,
+           ptr_sLinks[0].szName, (unsigned long long)ptr_sLinks[0].u64Interrupts,
+           ptr_sLinks[1].szName, (unsigned long long)ptr_sLinks[1].u64Interrupts,
+           (unsigned long long)LOC_u64Cycles, (unsigned long long)copy_u64ThreadCycles);
+}
+
+int main(void)
+{
+    const uint64_t LOC_au64BodyCycles[MODEL_HANDLER_BODY_POINTS] = MODEL_HANDLER_BODY_CYCLES;
+    char LOC_szDesign[32];
+    int LOC_iPoint;
+    uint64_t LOC_u64ThreadCycles;
+
+    printf("%lu Hz core, SCK = PCLK / %lu, %lu cycles per frame, both gates idle for 1 s\n",
+           MODEL_CORE_HZ, MODEL_SPI_PRESCALER, MODEL_FRAME_CYCLES);
+    printf("IRQ entry %lu, return %lu, tail-chaining %lu cycles\n",
+           MODEL_IRQ_ENTRY_CYCLES, MODEL_IRQ_EXIT_CYCLES, MODEL_IRQ_TAIL_CHAIN_CYCLES);
+
+    for(LOC_iPoint = 0; LOC_iPoint < MODEL_HANDLER_BODY_POINTS; LOC_iPoint++)
+    {
+        /*The old firmware set the SPI1 priority twice, SPI2 kept priority 0*/
+        sLink_t LOC_sLinks[MODEL_LINKS] = {
+            {"SPI1", MODEL_ENTRANCE_GATE_ADDRESS, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {"SPI2", MODEL_EXIT_GATE_ADDRESS, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+        };
+
+        LOC_u64ThreadCycles = Model_Run(LOC_sLinks, MODEL_OLD_TXE_HANDLER, LOC_au64BodyCycles[LOC_iPoint]);
+
+        snprintf(LOC_szDesign, sizeof(LOC_szDesign), "TXE handler, %llu cycle body:",
+                 (unsigned long long)LOC_au64BodyCycles[LOC_iPoint]);
+        Model_Report(LOC_szDesign, LOC_sLinks, LOC_u64ThreadCycles);
+    }
+
+    {
+        /*No request, no cache update and no occupancy change, nothing is queued on either link*/
+        sLink_t LOC_sLinks[MODEL_LINKS] = {
+            {"SPI1", MODEL_ENTRANCE_GATE_ADDRESS, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {"SPI2", MODEL_EXIT_GATE_ADDRESS, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+        };
+
+        LOC_u64ThreadCycles = Model_Run(LOC_sLinks, MODEL_RXNE_ENGINE, LOC_au64BodyCycles[0]);
+        Model_Report("RXNE engine:", LOC_sLinks, LOC_u64ThreadCycles);
+    }
+
+    return 0;
+}
@@ -86,4 +86,10 @@ void st_AlarmManager_FailedIDAuthentication(void);
  */
 void st_AlarmManager_SuccessfullIDAuthentication(void);
 
+/**
+ * @brief This state turns off the green LED after the gate closed.
+ * 
+ */
+void st_AlarmManager_GateClosed(void);
+
 #endif /* ALARM_MANAGER_INTERFACE_H_ */
\ No newline at end of file
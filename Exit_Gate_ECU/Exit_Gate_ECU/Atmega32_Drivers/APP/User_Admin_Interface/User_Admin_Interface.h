@@ -33,8 +33,10 @@
   */
 #include "../MCAL/GPIO/Atmega32_GPIO.h"
 #include "Timer0/Atmega32_Timer0.h"
+#include "Timer1/Atmega32_Timer1.h"
 #include "UART/Atmega32_UART.h"
 #include "SPI/Atmega32_SPI.h"
+#include "EEPROM/Atmega32_EEPROM.h"
 
 /**
   * @}
@@ -44,6 +46,7 @@
   * @{
   */
 #include "LCD_Driver/LCD_interface.h"
+#include "RFID_Reader_Driver/RFID_Reader_Interface.h"
 /**
   * @}
   */
@@ -88,9 +91,27 @@ void st_UAI_Idle(void);
 /**
  * @brief this state sends the driver's ID to the Admin ECU for authentication. 
  * 
+ * @note An ID found in the up to date authorization cache opens the gate right away, the Admin ECU
+ * is only notified. While the Admin ECU is unreachable the driver is authenticated from the snapshot.
  */
 void st_UAI_SendIDToAdmin(void);
 
+/**
+ * @brief This state tells the waiting driver where the request is, queued behind others or waiting
+ * for the Admin ECU to have room for it.
+ * 
+ */
+void st_UAI_ShowWaitMsg(void);
+
+/**
+ * @brief This state authenticates the driver from the last allow-list known to this gate while the
+ * Admin ECU is unreachable.
+ * 
+ * @note A driver let in is journaled and replayed to the Admin ECU once it answers again, the other
+ * IDs are refused as they can't be checked.
+ */
+void st_UAI_OfflineAuthentication(void);
+
 /**
  * @brief This state sends the open gate request and informs the driver that his ID is valid.
  * 
@@ -104,4 +125,24 @@ void st_UAI_IDAuthenticationPassed(void);
  */
 void st_UAI_IDAuthenticationFailed(void);
 
+/**
+ * @brief This state shows the slots left, the reason of a refusal and the message sent with the result
+ * under the result the Alarm_Manager shows.
+ * 
+ */
+void st_UAI_ShowResultDetail(void);
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Supported by "User_Admin_Interface"
+*===============================================
+*/
+
+/**
+ * @brief This function returns the service time of the last vehicle, from the card read until the gate closed.
+ * 
+ * @return uint32_t : The service time in milliseconds, 0 if no vehicle was served yet.
+ */
+uint32_t UAI_GetLastServiceTimeMs(void);
+
 #endif /* USER_ADMIN_INTERFACE_H_ */
\ No newline at end of file
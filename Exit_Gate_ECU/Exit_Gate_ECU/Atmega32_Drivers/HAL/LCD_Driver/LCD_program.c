@@ -58,9 +58,9 @@ void _delay_ms(uint8_t delay_Counter)
  */
 void LCD_Enable_Pulse()
 {
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_HIGH);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_HIGH);
 	_delay_ms(50);
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
 }
 
 /*
@@ -123,8 +123,8 @@ void LCD_Init(void)
 
 
 	/*Select ins register, Write operation and Enable zero*/
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_INS_REG);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_INS_REG);
 	_delay_ms(15);
 
 #if LCD_MODE_ == EIGHT_BIT_MODE
@@ -207,33 +207,33 @@ void LCD_Send_Command(uint8_t command)
 	/*LCD_Busy_Wait();*/
 
 	/*Select ins register, Write operation and Enable zero*/
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_INS_REG);
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_INS_REG);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
 
 #if LCD_MODE_ == EIGHT_BIT_MODE
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN0, READ_BIT(command, 0));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN1, READ_BIT(command, 1));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN2, READ_BIT(command, 2));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN3, READ_BIT(command, 3));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(command, 4));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(command, 5));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(command, 6));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(command, 7));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN0, READ_BIT(command, 0));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN1, READ_BIT(command, 1));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN2, READ_BIT(command, 2));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN3, READ_BIT(command, 3));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(command, 4));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(command, 5));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(command, 6));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(command, 7));
 
 	LCD_Enable_Pulse();
 #elif LCD_MODE_ == FOUR_BIT_MODE
 	/*Send the command upper nibble first*/
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(command, 4));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(command, 5));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(command, 6));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(command, 7));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(command, 4));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(command, 5));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(command, 6));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(command, 7));
 	LCD_Enable_Pulse();
 
 	/*Send the command lower nibble first*/
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(command, 0));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(command, 1));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(command, 2));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(command, 3));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(command, 0));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(command, 1));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(command, 2));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(command, 3));
 	LCD_Enable_Pulse();
 #endif
 }
@@ -256,34 +256,34 @@ void LCD_Send_Char(uint8_t data)
 	Check_End_Of_Line();
 
 	/*Data reigster, Write operation and Enable zero*/
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_DATA_REG);
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_DATA_REG);
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_EN_PIN, GPIO_PIN_LOW);
 
 
 #if LCD_MODE_ == EIGHT_BIT_MODE
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN0, READ_BIT(data, 0));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN1, READ_BIT(data, 1));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN2, READ_BIT(data, 2));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, GPIO_PIN3, READ_BIT(data, 3));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(data, 4));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(data, 5));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(data, 6));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(data, 7));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN0, READ_BIT(data, 0));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN1, READ_BIT(data, 1));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN2, READ_BIT(data, 2));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, GPIO_PIN3, READ_BIT(data, 3));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(data, 4));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(data, 5));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(data, 6));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(data, 7));
 
 	LCD_Enable_Pulse();
 #elif LCD_MODE_ == FOUR_BIT_MODE
 	/*Send the data upper nibble first*/
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(data, 4));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(data, 5));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(data, 6));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(data, 7));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(data, 4));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(data, 5));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(data, 6));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(data, 7));
 	LCD_Enable_Pulse();
 
 	/*Send the data lower nibble first*/
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(data, 0));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(data, 1));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(data, 2));
-	MCAL_GPIO_WritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(data, 3));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D4, READ_BIT(data, 0));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D5, READ_BIT(data, 1));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D6, READ_BIT(data, 2));
+	MCAL_GPIO_FastWritePin(LCD_DATA_PORT, LCD_D7, READ_BIT(data, 3));
 	LCD_Enable_Pulse();
 #endif
 	charCounter++;
@@ -412,7 +412,7 @@ void LCD_Busy_Wait()
 	config.pinMode = GPIO_MODE_INPUT_FLOATING;
 	MCAL_GPIO_Init(LCD_CTRL_PORT, &config);
 #endif
-	MCAL_GPIO_WritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_INS_REG); 	/*RS = 0      INS register*/
+	MCAL_GPIO_FastWritePin(LCD_CTRL_PORT, LCD_RS_PIN, LCD_INS_REG); 	/*RS = 0      INS register*/
 
 	LCD_Enable_Pulse();
 
@@ -54,7 +54,10 @@ void HAL_LED_Init(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin);
  * @param copy_LED_Pin  :   The GPIO pin that is connected to the LED.
  * @param copy_LEDState :   The new state of the LED must be a value of @ref LED_DEFINE.
  */
-void HAL_LED_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin, eLEDStatus_t copy_LEDState);
+GPIO_FORCE_INLINE void HAL_LED_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin, eLEDStatus_t copy_LEDState)
+{
+    MCAL_GPIO_FastWritePin(GPIOx, copy_LED_Pin, copy_LEDState);
+}
 
 /**
  * @brief This function toggles the current state of the LED. 
@@ -62,6 +65,9 @@ void HAL_LED_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin, eLEDSt
  * @param GPIOx         :   The GPIO port that is connected to the LED.
  * @param copy_LED_Pin  :   The GPIO pin that is connected to the LED.
  */
-void HAL_LED_ToggleState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin);
+GPIO_FORCE_INLINE void HAL_LED_ToggleState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin)
+{
+    MCAL_GPIO_FastTogglePin(GPIOx, copy_LED_Pin);
+}
 
 #endif /* LED_DRIVER_INTERFACE_H_ */
\ No newline at end of file
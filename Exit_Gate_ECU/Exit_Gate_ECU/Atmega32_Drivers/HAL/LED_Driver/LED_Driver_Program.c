@@ -38,27 +38,3 @@ void HAL_LED_Init(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin)
 
     MCAL_GPIO_Init(GPIOx, &cfg);
 }
-
-/**
- * @brief This function sets the state of the LED.
- * 
- * @param GPIOx         :   The GPIO port that is connected to the LED.
- * @param copy_LED_Pin  :   The GPIO pin that is connected to the LED.
- * @param copy_LEDState :   The new state of the LED must be a value of @ref LED_DEFINE.
- */
-void HAL_LED_SetState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin, eLEDStatus_t copy_LEDState)
-{
-    MCAL_GPIO_WritePin(GPIOx, copy_LED_Pin, copy_LEDState);
-}
-
-
-/**
- * @brief This function toggles the current state of the LED. 
- * 
- * @param GPIOx         :   The GPIO port that is connected to the LED.
- * @param copy_LED_Pin  :   The GPIO pin that is connected to the LED.
- */
-void HAL_LED_ToggleState(volatile GPIO_typedef* GPIOx, uint8_t copy_LED_Pin)
-{
-    MCAL_GPIO_TogglePin(GPIOx, copy_LED_Pin);
-}
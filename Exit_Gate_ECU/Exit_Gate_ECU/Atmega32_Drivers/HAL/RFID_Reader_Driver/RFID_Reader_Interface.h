@@ -0,0 +1,93 @@
+/**
+ * @file RFID_Reader_Interface.h
+ * 
+ * @brief This file contains the APIs for the HAL RFID reader driver, it parses the frames sent by 125 kHz readers
+ *  (RDM6300 / EM18 like) one byte at a time so it can be fed directly from the UART receive ISR.
+ * 
+ * @note Frame format: STX | 10 ASCII hex tag characters | 2 ASCII hex checksum characters | ETX
+ *  The checksum is the XOR of the 5 bytes encoded by the tag characters.
+ * 
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ * 
+ * @date 18-10-2026
+ * 
+ * @version 1.0
+ */
+
+#ifndef RFID_READER_INTERFACE_H_
+#define RFID_READER_INTERFACE_H_
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Platform_Types.h"
+
+/** @defgroup RFID_FRAME_DEFINES
+  * @{
+  */
+#define RFID_FRAME_STX              0x02u
+#define RFID_FRAME_ETX              0x03u
+
+/*Number of ASCII hex characters carrying the tag number*/
+#define RFID_TAG_SIZE               10u
+/**
+  * @}
+  */
+
+/**
+ * @brief This enum has the result of feeding a byte to the parser.
+ * 
+ * @param  RFID_FrameIncomplete: The byte was accepted (or ignored while waiting for STX), no frame is ready yet.
+ * @param  RFID_FrameComplete: The byte completed a frame with a valid checksum, the tag can be read now.
+ * @param  RFID_FrameError: The byte broke the frame (bad character or checksum), the parser went back to wait for STX.
+ */
+typedef enum{
+    RFID_FrameIncomplete,
+    RFID_FrameComplete,
+    RFID_FrameError
+}eRFIDFrameStatus_t;
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Supported by "HAL RFID READER DRIVER"
+*===============================================
+*/
+
+/**
+ * @brief This function resets the parser to wait for the start of a new frame.
+ * 
+ * @note Any partially received frame is dropped, the last completed tag stays readable.
+ */
+void HAL_RFID_Reset(void);
+
+/**
+ * @brief This function feeds one received byte to the frame parser.
+ * 
+ * @param copy_u8Byte : The byte received from the reader.
+ * @return eRFIDFrameStatus_t : RFID_FrameComplete when a valid frame was just completed,
+ *                              RFID_FrameError when the frame was dropped, RFID_FrameIncomplete otherwise.
+ * 
+ * @note An STX byte always starts a new frame, so the parser resynchronizes on the next frame after any noise.
+ */
+eRFIDFrameStatus_t HAL_RFID_ParseByte(uint8_t copy_u8Byte);
+
+/**
+ * @brief This function returns the tag of the last valid frame.
+ * 
+ * @return const uint8_t* : Pointer to the RFID_TAG_SIZE ASCII characters of the tag followed by a NULL character.
+ * 
+ * @note The tag is stored in the parser's own buffer (no copy), it stays valid until another frame is completed
+ *  as the next frame is received in a second buffer.
+ */
+const uint8_t* HAL_RFID_GetTag(void);
+
+/**
+ * @brief This function returns the number of frames dropped because of bad characters or checksum.
+ * 
+ * @return uint16_t : The number of dropped frames, saturates at 0xFFFF.
+ */
+uint16_t HAL_RFID_GetErrorCount(void);
+
+#endif /* RFID_READER_INTERFACE_H_ */
@@ -0,0 +1,271 @@
+/**
+ * @file RFID_Reader_Program.c
+ * 
+ * @brief This file contains the APIs implementation for the HAL RFID reader driver, a byte at a time
+ *  state machine parsing the frames of 125 kHz readers (RDM6300 / EM18 like).
+ * 
+ * @author Hossam_Eid (eidhossam7@gmail.com)
+ * 
+ * @date 18-10-2026
+ * 
+ * @version 1.0
+ */
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "RFID_Reader_Interface.h"
+
+/** @defgroup Local Macros
+  * @{
+  */
+/*Number of ASCII hex characters carrying the checksum*/
+#define RFID_CHECKSUM_SIZE          2u
+
+#define RFID_INVALID_NIBBLE         0xFFu
+
+/** @defgroup Parser_States
+  * @{
+  */
+#define RFID_WAITING_STX            0
+#define RFID_RECEIVING_TAG          1
+#define RFID_RECEIVING_CHECKSUM     2
+#define RFID_WAITING_ETX            3
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup Local Variables
+  * @{
+  */
+/*Two buffers so a new frame can be received while the last tag is still in use*/
+static uint8_t Glob_u8TagBuffers[2][RFID_TAG_SIZE + 1];
+
+/*Index of the buffer holding the last valid tag, the other one is filled by the parser*/
+static volatile uint8_t Glob_u8ReadyBuffer = 0;
+
+static uint8_t Glob_u8ParserState = RFID_WAITING_STX;
+static uint8_t Glob_u8CharCounter = 0;
+
+/*XOR of the bytes encoded by the tag characters*/
+static uint8_t Glob_u8Checksum = 0;
+
+/*Value of the received checksum characters*/
+static uint8_t Glob_u8ReceivedChecksum = 0;
+
+static uint16_t Glob_u16ErrorCount = 0;
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+===============================================
+*               Private Functions
+*===============================================
+*/
+
+/**
+ * @brief This function converts an ASCII hex character to its value.
+ * 
+ * @param copy_u8Char : The ASCII character.
+ * @return uint8_t : The value of the character (0 - 15), RFID_INVALID_NIBBLE if it's not a hex character.
+ */
+static uint8_t RFID_HexToNibble(uint8_t copy_u8Char)
+{
+    uint8_t LOC_u8Nibble = RFID_INVALID_NIBBLE;
+
+    if((copy_u8Char >= '0') && (copy_u8Char <= '9'))
+    {
+        LOC_u8Nibble = copy_u8Char - '0';
+    }else if((copy_u8Char >= 'A') && (copy_u8Char <= 'F'))
+    {
+        LOC_u8Nibble = copy_u8Char - 'A' + 10u;
+    }else if((copy_u8Char >= 'a') && (copy_u8Char <= 'f'))
+    {
+        LOC_u8Nibble = copy_u8Char - 'a' + 10u;
+    }else{
+
+    }
+
+    return LOC_u8Nibble;
+}
+
+/**
+ * @brief This function starts receiving a new frame.
+ * 
+ */
+static void RFID_StartFrame(void)
+{
+    Glob_u8ParserState = RFID_RECEIVING_TAG;
+    Glob_u8CharCounter = 0;
+    Glob_u8Checksum = 0;
+    Glob_u8ReceivedChecksum = 0;
+}
+
+/**
+ * @brief This function drops the current frame and waits for the next STX.
+ * 
+ */
+static void RFID_DropFrame(void)
+{
+    Glob_u8ParserState = RFID_WAITING_STX;
+
+    if(Glob_u16ErrorCount != 0xFFFFu)
+    {
+        Glob_u16ErrorCount++;
+    }else{
+
+    }
+}
+
+/**************************************************************************************************************************
+===============================================
+*               APIs Definitions
+*===============================================
+*/
+
+/**
+ * @brief This function resets the parser to wait for the start of a new frame.
+ * 
+ * @note Any partially received frame is dropped, the last completed tag stays readable.
+ */
+void HAL_RFID_Reset(void)
+{
+    Glob_u8ParserState = RFID_WAITING_STX;
+}
+
+/**
+ * @brief This function feeds one received byte to the frame parser.
+ * 
+ * @param copy_u8Byte : The byte received from the reader.
+ * @return eRFIDFrameStatus_t : RFID_FrameComplete when a valid frame was just completed,
+ *                              RFID_FrameError when the frame was dropped, RFID_FrameIncomplete otherwise.
+ * 
+ * @note An STX byte always starts a new frame, so the parser resynchronizes on the next frame after any noise.
+ */
+eRFIDFrameStatus_t HAL_RFID_ParseByte(uint8_t copy_u8Byte)
+{
+    eRFIDFrameStatus_t LOC_eStatus = RFID_FrameIncomplete;
+    uint8_t LOC_u8Nibble;
+    uint8_t* LOC_pu8Tag = Glob_u8TagBuffers[Glob_u8ReadyBuffer ^ 1u];
+
+    if(copy_u8Byte == RFID_FRAME_STX)
+    {
+        /*A frame cut by noise is dropped and the parser locks on the new one*/
+        if(Glob_u8ParserState != RFID_WAITING_STX)
+        {
+            RFID_DropFrame();
+            LOC_eStatus = RFID_FrameError;
+        }else{
+
+        }
+
+        RFID_StartFrame();
+    }else{
+        switch (Glob_u8ParserState)
+        {
+        case RFID_RECEIVING_TAG:
+            LOC_u8Nibble = RFID_HexToNibble(copy_u8Byte);
+
+            if(LOC_u8Nibble == RFID_INVALID_NIBBLE)
+            {
+                RFID_DropFrame();
+                LOC_eStatus = RFID_FrameError;
+            }else{
+                LOC_pu8Tag[Glob_u8CharCounter] = copy_u8Byte;
+
+                /*Every 2 characters encode one byte of the checksum*/
+                if(Glob_u8CharCounter & 1u)
+                {
+                    Glob_u8Checksum ^= (RFID_HexToNibble(LOC_pu8Tag[Glob_u8CharCounter - 1u]) << 4) | LOC_u8Nibble;
+                }else{
+
+                }
+
+                Glob_u8CharCounter++;
+
+                if(Glob_u8CharCounter == RFID_TAG_SIZE)
+                {
+                    Glob_u8CharCounter = 0;
+                    Glob_u8ParserState = RFID_RECEIVING_CHECKSUM;
+                }else{
+
+                }
+            }
+            break;
+
+        case RFID_RECEIVING_CHECKSUM:
+            LOC_u8Nibble = RFID_HexToNibble(copy_u8Byte);
+
+            if(LOC_u8Nibble == RFID_INVALID_NIBBLE)
+            {
+                RFID_DropFrame();
+                LOC_eStatus = RFID_FrameError;
+            }else{
+                Glob_u8ReceivedChecksum = (Glob_u8ReceivedChecksum << 4) | LOC_u8Nibble;
+
+                Glob_u8CharCounter++;
+
+                if(Glob_u8CharCounter == RFID_CHECKSUM_SIZE)
+                {
+                    Glob_u8ParserState = RFID_WAITING_ETX;
+                }else{
+
+                }
+            }
+            break;
+
+        case RFID_WAITING_ETX:
+            if((copy_u8Byte == RFID_FRAME_ETX) && (Glob_u8ReceivedChecksum == Glob_u8Checksum))
+            {
+                LOC_pu8Tag[RFID_TAG_SIZE] = '\0';
+
+                /*Publish the tag, the next frame goes to the other buffer*/
+                Glob_u8ReadyBuffer ^= 1u;
+
+                Glob_u8ParserState = RFID_WAITING_STX;
+                LOC_eStatus = RFID_FrameComplete;
+            }else{
+                RFID_DropFrame();
+                LOC_eStatus = RFID_FrameError;
+            }
+            break;
+
+        case RFID_WAITING_STX:
+        default:
+            /*Noise between frames is ignored*/
+            break;
+        }
+    }
+
+    return LOC_eStatus;
+}
+
+/**
+ * @brief This function returns the tag of the last valid frame.
+ * 
+ * @return const uint8_t* : Pointer to the RFID_TAG_SIZE ASCII characters of the tag followed by a NULL character.
+ * 
+ * @note The tag is stored in the parser's own buffer (no copy), it stays valid until another frame is completed
+ *  as the next frame is received in a second buffer.
+ */
+const uint8_t* HAL_RFID_GetTag(void)
+{
+    return Glob_u8TagBuffers[Glob_u8ReadyBuffer];
+}
+
+/**
+ * @brief This function returns the number of frames dropped because of bad characters or checksum.
+ * 
+ * @return uint16_t : The number of dropped frames, saturates at 0xFFFF.
+ */
+uint16_t HAL_RFID_GetErrorCount(void)
+{
+    return Glob_u16ErrorCount;
+}
@@ -1,12 +1,12 @@
 /**
  * @file Servo_Motor_Interface.h
- * 
+ *
  * @brief This file holds the interface and APIs to use a PWM controlled servo motor.
- * 
+ *
  * @author Hossam_Eid (eidhossam7@gmail.com)
- * 
+ *
  * @date 10-03-2024
- * 
+ *
  * @version 1.0
  */
 
@@ -18,7 +18,41 @@
 *                   Includes
 *===============================================
 */
-#include "../../MCAL/Timer2/Atmega32_Timer2.h"
+#include "../../MCAL/Timer1/Atmega32_Timer1.h"
+
+/**************************************************************************************************************************
+*===============================================
+*         Servo motor configuration
+*===============================================
+*/
+
+/** @defgroup SERVO_MOTOR_CONFIGURATION
+  * @brief The servo is driven from OC1A (PD5) with one pulse every frame, TIMER1 runs at one tick per microsecond.
+  * @{
+  */
+
+/*Length of one PWM frame in microseconds, the motion profile is stepped once per frame*/
+#define SERVO_FRAME_PERIOD_US               20000u
+
+/*Pulse widths of the two ends of the servo range, calibrate them to the mounted servo
+  (swapping them reverses the direction of rotation)*/
+#define SERVO_PULSE_0DEGREE_US              500u
+#define SERVO_PULSE_180DEGREE_US            2500u
+
+/*Cruise speed of the motion profile in microseconds of pulse width per frame, keep it
+  at or below the rated speed of the servo so it never lags behind the commanded position*/
+#define SERVO_MAX_SPEED_US_PER_FRAME        100u
+
+/*Speed change per frame while accelerating and decelerating*/
+#define SERVO_ACCELERATION_US_PER_FRAME     10u
+
+/**
+  * @}
+  */
+
+#if (SERVO_ACCELERATION_US_PER_FRAME == 0u) || (SERVO_MAX_SPEED_US_PER_FRAME < SERVO_ACCELERATION_US_PER_FRAME)
+#error "The servo acceleration must be non-zero and not above the servo max speed"
+#endif
 
 /**************************************************************************************************************************
 *===============================================
@@ -27,9 +61,9 @@
 */
 
 typedef enum{
-    ServoMotor_0Degree = 240,
-    ServoMotor_90Degree = 250,
-    ServoMotor_180Degree = 230
+    ServoMotor_0Degree = 0,
+    ServoMotor_90Degree = 90,
+    ServoMotor_180Degree = 180
 }eServoMotorDegree_t;
 
 /**************************************************************************************************************************
@@ -40,17 +74,36 @@ typedef enum{
 
 /**
  * @brief This function does the required initialization to use the servo motor.
- * 
+ *
  * @return eStatus_t: E_OK if the initialization was successful, E_NOK otherwise.
+ *
+ * @note The servo is placed at the 0 degree position without a motion profile, TIMER1 keeps
+ * running the uptime clock while it generates the servo PWM.
  */
 eStatus_t HAL_ServoMotorInit(void);
 
 /**
- * @brief This function turn the servo motor with the specified degree. 
- * 
- * @param copy_eDegree : Degree to turn the servo motor with.
- * @return eStatus_t   : Status of the operation.
+ * @brief This function starts moving the servo motor to the specified degree following a trapezoidal
+ * motion profile, a new request while moving takes over from the current position and speed.
+ *
+ * @param copy_eDegree        : Degree to turn the servo motor to (0 - 180).
+ * @param copy_fptrMotionDone : Function called from the TIMER1 ISR when the position is reached, NULL for none.
+ * @return eStatus_t          : Status of the operation.
+ */
+eStatus_t HAL_ServoMotorTurn(eServoMotorDegree_t copy_eDegree, Ptr_Func copy_fptrMotionDone);
+
+/**
+ * @brief This function checks if the servo motor is still following a motion profile.
+ *
+ * @return boolean : TRUE while the servo is moving, FALSE otherwise.
+ */
+boolean HAL_ServoMotorIsMoving(void);
+
+/**
+ * @brief This function returns the duration of the last completed motion.
+ *
+ * @return uint32_t : Time from the turn request until the position was reached in milliseconds.
  */
-eStatus_t HAL_ServoMotorTurn(eServoMotorDegree_t copy_eDegree);
+uint32_t HAL_ServoMotorGetLastMoveTimeMs(void);
 
-#endif /* SERVO_MOTOR_INTERFACE_H_ */
\ No newline at end of file
+#endif /* SERVO_MOTOR_INTERFACE_H_ */
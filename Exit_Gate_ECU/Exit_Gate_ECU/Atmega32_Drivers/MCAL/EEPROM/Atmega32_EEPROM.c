@@ -0,0 +1,584 @@
+/**
+**************************************************************************************************************************
+* @brief     : This module contains functions for reading and writing the internal EEPROM.
+* @author    : Hossam Eid
+* @date      : 18/10/2026
+**************************************************************************************************************************
+* Description: This file contains the function definitions for the EEPROM driver.
+**************************************************************************************************************************
+*/
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Atmega32_EEPROM.h"
+
+/**************************************************************************************************************************
+===============================================
+*           LOCAL MACROS
+*===============================================
+*/
+/** @defgroup WRITE_QUEUE_MACROS
+  * @{
+  */
+#if ((EEPROM_WRITE_BUFFER_SIZE & (EEPROM_WRITE_BUFFER_SIZE - 1u)) != 0u) || (EEPROM_WRITE_BUFFER_SIZE > 128u)
+#error "EEPROM_WRITE_BUFFER_SIZE must be a power of 2 not larger than 128"
+#endif
+
+#if ((EEPROM_WRITE_QUEUE_SIZE & (EEPROM_WRITE_QUEUE_SIZE - 1u)) != 0u) || (EEPROM_WRITE_QUEUE_SIZE > 128u)
+#error "EEPROM_WRITE_QUEUE_SIZE must be a power of 2 not larger than 128"
+#endif
+
+#define EEPROM_WRITE_BUFFER_MASK        (EEPROM_WRITE_BUFFER_SIZE - 1u)
+#define EEPROM_WRITE_QUEUE_MASK         (EEPROM_WRITE_QUEUE_SIZE - 1u)
+
+/*Number of free bytes and blocks in the write queue*/
+#define EEPROM_WRITE_BUFFER_FREE()      ((uint8_t)(EEPROM_WRITE_BUFFER_MASK - ((Glob_u8DataHead - Glob_u8DataTail) & EEPROM_WRITE_BUFFER_MASK)))
+#define EEPROM_WRITE_QUEUE_FREE()       ((uint8_t)(EEPROM_WRITE_QUEUE_MASK - ((Glob_u8JobHead - Glob_u8JobTail) & EEPROM_WRITE_QUEUE_MASK)))
+/**
+  * @}
+  */
+
+/** @defgroup READ_CACHE_MACROS
+  * @{
+  */
+#if ((EEPROM_READ_CACHE_LINES & (EEPROM_READ_CACHE_LINES - 1u)) != 0u) || \
+    ((EEPROM_READ_CACHE_LINE_SIZE & (EEPROM_READ_CACHE_LINE_SIZE - 1u)) != 0u) || \
+    ((EEPROM_SIZE / EEPROM_READ_CACHE_LINE_SIZE) > 255u)
+#error "The EEPROM read cache lines must be powers of 2 and the EEPROM must not exceed 255 lines"
+#endif
+
+/*The line of the EEPROM holding an address and the cache line it's kept in*/
+#define EEPROM_LINE_OF(ADDRESS)         ((uint8_t)((ADDRESS) / EEPROM_READ_CACHE_LINE_SIZE))
+#define EEPROM_CACHE_INDEX_OF(LINE)     ((LINE) & (EEPROM_READ_CACHE_LINES - 1u))
+#define EEPROM_LINE_OFFSET_OF(ADDRESS)  ((ADDRESS) & (EEPROM_READ_CACHE_LINE_SIZE - 1u))
+
+/*The cache keeps the line number plus one, so zero marks an empty cache line*/
+#define EEPROM_CACHE_EMPTY_TAG          0u
+/**
+  * @}
+  */
+
+/** @defgroup RECORD_MACROS
+  * @{
+  */
+#define EEPROM_RECORD_PAYLOAD_INDEX             0u
+#define EEPROM_RECORD_CRC_INDEX(SIZE)           (SIZE)
+#define EEPROM_RECORD_SEQUENCE_INDEX(SIZE)      ((SIZE) + 1u)
+
+/*An erased copy reads 0xFF, so the sequence skips it and a copy holding it is never valid*/
+#define EEPROM_RECORD_ERASED_SEQUENCE   0xFFu
+#define EEPROM_RECORD_NEXT_SEQUENCE(SEQ)    (((SEQ) >= 0xFEu)? 0u : (uint8_t)((SEQ) + 1u))
+
+#define EEPROM_CRC8_POLYNOMIAL          0x07u
+#define EEPROM_CRC8_INIT                0x00u
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+*===============================================
+*                Local Types
+*===============================================
+*/
+typedef struct{
+    uint16_t u16Address;                    /*!<Address of the first byte of the block*/
+    uint8_t  u8Length;                      /*!<Number of bytes, they follow each other in the write buffer*/
+}sEEPROM_WriteJob_t;
+
+/**************************************************************************************************************************
+===============================================
+*           Local Variables
+*===============================================
+*/
+
+/** @defgroup Write queue, filled by the main loop and drained by the EEPROM ready ISR
+  * @{
+  */
+static uint8_t Glob_au8WriteBuffer[EEPROM_WRITE_BUFFER_SIZE];
+static volatile uint8_t Glob_u8DataHead = 0;
+static volatile uint8_t Glob_u8DataTail = 0;
+
+static sEEPROM_WriteJob_t Glob_asWriteJobs[EEPROM_WRITE_QUEUE_SIZE];
+static volatile uint8_t Glob_u8JobHead = 0;
+static volatile uint8_t Glob_u8JobTail = 0;
+
+/*Bytes of the oldest block already taken by the ISR*/
+static volatile uint8_t Glob_u8JobOffset = 0;
+/**
+  * @}
+  */
+
+/** @defgroup Read cache, always holds the newest data including the queued bytes
+  * @{
+  */
+static uint8_t Glob_au8ReadCache[EEPROM_READ_CACHE_LINES][EEPROM_READ_CACHE_LINE_SIZE];
+static uint8_t Glob_au8ReadCacheTag[EEPROM_READ_CACHE_LINES];
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+===============================================
+*           Private Functions
+*===============================================
+*/
+
+/**
+ * @brief This function copies bytes to the write buffer and to the cached lines holding their addresses.
+ *
+ * @param copy_u16Address : Address of the first byte in the EEPROM.
+ * @param ptr_u8Data      : Bytes to write.
+ * @param copy_u8Length   : Number of bytes, the caller makes sure they fit.
+ *
+ * @note Called with the interrupts disabled.
+ */
+static void EEPROM_PushBytes(uint16_t copy_u16Address, const uint8_t* ptr_u8Data, uint8_t copy_u8Length)
+{
+    uint8_t LOC_u8Line;
+    uint8_t LOC_u8Index;
+
+    while(copy_u8Length--)
+    {
+        Glob_au8WriteBuffer[Glob_u8DataHead] = *ptr_u8Data;
+        Glob_u8DataHead = (Glob_u8DataHead + 1u) & EEPROM_WRITE_BUFFER_MASK;
+
+        LOC_u8Line = EEPROM_LINE_OF(copy_u16Address);
+        LOC_u8Index = EEPROM_CACHE_INDEX_OF(LOC_u8Line);
+
+        if(Glob_au8ReadCacheTag[LOC_u8Index] == (uint8_t)(LOC_u8Line + 1u))
+        {
+            Glob_au8ReadCache[LOC_u8Index][EEPROM_LINE_OFFSET_OF(copy_u16Address)] = *ptr_u8Data;
+        }else{
+
+        }
+
+        ptr_u8Data++;
+        copy_u16Address++;
+    }
+}
+
+/**
+ * @brief This function queues the block made of the last pushed bytes and starts draining the queue.
+ *
+ * @param copy_u16Address : Address of the first byte in the EEPROM.
+ * @param copy_u8Length   : Number of bytes pushed for the block.
+ *
+ * @note Called with the interrupts disabled.
+ */
+static void EEPROM_CommitJob(uint16_t copy_u16Address, uint8_t copy_u8Length)
+{
+    Glob_asWriteJobs[Glob_u8JobHead].u16Address = copy_u16Address;
+    Glob_asWriteJobs[Glob_u8JobHead].u8Length = copy_u8Length;
+
+    Glob_u8JobHead = (Glob_u8JobHead + 1u) & EEPROM_WRITE_QUEUE_MASK;
+
+    /*The interrupt fires as soon as the EEPROM is ready*/
+    EEPROM->EECR |= EEPROM_EECR_EERIE_MASK;
+}
+
+/**
+ * @brief This function fills a cache line from the EEPROM then applies the bytes still in the write queue.
+ *
+ * @param copy_u8Line : Line of the EEPROM to be cached.
+ *
+ * @note The queue is held while the line is read so no queued byte is written in between.
+ */
+static void EEPROM_FillCacheLine(uint8_t copy_u8Line)
+{
+    uint8_t  LOC_u8Index = EEPROM_CACHE_INDEX_OF(copy_u8Line);
+    uint16_t LOC_u16LineAddress = (uint16_t)copy_u8Line * EEPROM_READ_CACHE_LINE_SIZE;
+    uint16_t LOC_u16Address;
+    uint8_t  LOC_u8Offset;
+    uint8_t  LOC_u8Job;
+    uint8_t  LOC_u8Data;
+    uint8_t  LOC_u8SREG;
+
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    EEPROM->EECR &= ~(EEPROM_EECR_EERIE_MASK);
+
+    SREG = LOC_u8SREG;
+
+    /*Wait for the byte being written, the address register can't change before*/
+    while(EEPROM->EECR & EEPROM_EECR_EEWE_MASK);
+
+    for(LOC_u8Offset = 0; LOC_u8Offset < EEPROM_READ_CACHE_LINE_SIZE; LOC_u8Offset++)
+    {
+        EEPROM->EEAR = LOC_u16LineAddress + LOC_u8Offset;
+        EEPROM->EECR |= EEPROM_EECR_EERE_MASK;
+
+        Glob_au8ReadCache[LOC_u8Index][LOC_u8Offset] = EEPROM->EEDR;
+    }
+
+    /*The queued bytes are newer than the EEPROM, the oldest block starts after the bytes already written*/
+    LOC_u8Data = Glob_u8DataTail;
+
+    for(LOC_u8Job = Glob_u8JobTail; LOC_u8Job != Glob_u8JobHead; LOC_u8Job = (LOC_u8Job + 1u) & EEPROM_WRITE_QUEUE_MASK)
+    {
+        LOC_u8Offset = (LOC_u8Job == Glob_u8JobTail)? Glob_u8JobOffset : 0u;
+
+        for(; LOC_u8Offset < Glob_asWriteJobs[LOC_u8Job].u8Length; LOC_u8Offset++)
+        {
+            LOC_u16Address = Glob_asWriteJobs[LOC_u8Job].u16Address + LOC_u8Offset;
+
+            if(EEPROM_LINE_OF(LOC_u16Address) == copy_u8Line)
+            {
+                Glob_au8ReadCache[LOC_u8Index][EEPROM_LINE_OFFSET_OF(LOC_u16Address)] = Glob_au8WriteBuffer[LOC_u8Data];
+            }else{
+
+            }
+
+            LOC_u8Data = (LOC_u8Data + 1u) & EEPROM_WRITE_BUFFER_MASK;
+        }
+    }
+
+    Glob_au8ReadCacheTag[LOC_u8Index] = copy_u8Line + 1u;
+
+    LOC_u8SREG = SREG;
+    G_INTERRUPT_DISABLE;
+
+    if(Glob_u8JobHead != Glob_u8JobTail)
+    {
+        EEPROM->EECR |= EEPROM_EECR_EERIE_MASK;
+    }else{
+
+    }
+
+    SREG = LOC_u8SREG;
+}
+
+/**
+ * @brief This function reads one byte through the read cache.
+ *
+ * @param copy_u16Address : Address of the byte.
+ * @return uint8_t        : The newest value of the byte.
+ */
+static uint8_t EEPROM_ReadByte(uint16_t copy_u16Address)
+{
+    uint8_t LOC_u8Line = EEPROM_LINE_OF(copy_u16Address);
+    uint8_t LOC_u8Index = EEPROM_CACHE_INDEX_OF(LOC_u8Line);
+
+    if(Glob_au8ReadCacheTag[LOC_u8Index] != (uint8_t)(LOC_u8Line + 1u))
+    {
+        EEPROM_FillCacheLine(LOC_u8Line);
+    }else{
+
+    }
+
+    return Glob_au8ReadCache[LOC_u8Index][EEPROM_LINE_OFFSET_OF(copy_u16Address)];
+}
+
+/**
+ * @brief This function updates a CRC-8 with a block of bytes.
+ *
+ * @param copy_u8CRC    : CRC of the previous bytes.
+ * @param ptr_u8Data    : The bytes.
+ * @param copy_u8Length : Number of bytes.
+ * @return uint8_t      : The updated CRC.
+ */
+static uint8_t EEPROM_CRC8(uint8_t copy_u8CRC, const uint8_t* ptr_u8Data, uint8_t copy_u8Length)
+{
+    uint8_t LOC_u8Bit;
+
+    while(copy_u8Length--)
+    {
+        copy_u8CRC ^= *ptr_u8Data++;
+
+        for(LOC_u8Bit = 0; LOC_u8Bit < 8u; LOC_u8Bit++)
+        {
+            copy_u8CRC = (copy_u8CRC & 0x80u)? (uint8_t)((copy_u8CRC << 1) ^ EEPROM_CRC8_POLYNOMIAL) :
+                                               (uint8_t)(copy_u8CRC << 1);
+        }
+    }
+
+    return copy_u8CRC;
+}
+
+/**
+ * @brief This function checks one copy of a record.
+ *
+ * @param copy_u16Address : Address of the copy.
+ * @param copy_u8Size     : Size of the payload.
+ * @param ptr_u8Sequence  : Receives the sequence of the copy.
+ * @return boolean        : TRUE if the copy is complete and not erased.
+ */
+static boolean EEPROM_IsValidCopy(uint16_t copy_u16Address, uint8_t copy_u8Size, uint8_t* ptr_u8Sequence)
+{
+    uint8_t LOC_u8CRC = EEPROM_CRC8_INIT;
+    uint8_t LOC_u8Byte;
+    uint8_t LOC_u8Index;
+
+    *ptr_u8Sequence = EEPROM_ReadByte(copy_u16Address + EEPROM_RECORD_SEQUENCE_INDEX(copy_u8Size));
+
+    /*The CRC covers the payload then the sequence*/
+    for(LOC_u8Index = 0; LOC_u8Index < copy_u8Size; LOC_u8Index++)
+    {
+        LOC_u8Byte = EEPROM_ReadByte(copy_u16Address + EEPROM_RECORD_PAYLOAD_INDEX + LOC_u8Index);
+        LOC_u8CRC = EEPROM_CRC8(LOC_u8CRC, &LOC_u8Byte, 1);
+    }
+
+    LOC_u8CRC = EEPROM_CRC8(LOC_u8CRC, ptr_u8Sequence, 1);
+
+    return ((EEPROM_RECORD_ERASED_SEQUENCE != *ptr_u8Sequence) &&
+            (EEPROM_ReadByte(copy_u16Address + EEPROM_RECORD_CRC_INDEX(copy_u8Size)) == LOC_u8CRC))? TRUE : FALSE;
+}
+
+/**************************************************************************************************************************
+*===============================================
+*  			APIs functions definitions
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_Read
+* @brief		:   Reads a block of bytes from the EEPROM, the bytes still in the write queue are read as queued.
+* @param [in]	:   copy_u16Address: Address of the first byte in the EEPROM.
+* @param [out]	:   ptr_u8Data: Buffer to hold the read bytes.
+* @param [in]	:   copy_u16Length: Number of bytes to read.
+* @return       :   eStatus_t: Status of the function call.
+* @Note         :   A read cache miss waits for the byte being written, at most one byte write time (8.5 ms).
+*               :   Must only be called from the main loop.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_Read(uint16_t copy_u16Address, uint8_t* ptr_u8Data, uint16_t copy_u16Length)
+{
+    eStatus_t status = E_OK;
+
+    if((NULL == ptr_u8Data) || !ASSERT_EEPROM_BLOCK(copy_u16Address, copy_u16Length))
+    {
+        status = E_NOK;
+    }else{
+        while(copy_u16Length--)
+        {
+            *ptr_u8Data++ = EEPROM_ReadByte(copy_u16Address++);
+        }
+    }
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_Write
+* @brief		:   Queues a block of bytes to be written to the EEPROM by the EEPROM ready interrupt.
+* @param [in]	:   copy_u16Address: Address of the first byte in the EEPROM.
+* @param [in]	:   ptr_u8Data: Bytes to write.
+* @param [in]	:   copy_u8Length: Number of bytes to write.
+* @return       :   eStatus_t: E_OK if the block was queued, E_NOK if there is no room for it (nothing is queued).
+* @Note         :   The bytes that already hold their value are skipped. Must only be called from the main loop.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_Write(uint16_t copy_u16Address, const uint8_t* ptr_u8Data, uint8_t copy_u8Length)
+{
+    eStatus_t status = E_OK;
+    uint8_t LOC_u8SREG;
+
+    if((NULL == ptr_u8Data) || (0u == copy_u8Length) || !ASSERT_EEPROM_BLOCK(copy_u16Address, copy_u8Length))
+    {
+        status = E_NOK;
+    }else{
+        LOC_u8SREG = SREG;
+        G_INTERRUPT_DISABLE;
+
+        if((copy_u8Length > EEPROM_WRITE_BUFFER_FREE()) || (0u == EEPROM_WRITE_QUEUE_FREE()))
+        {
+            status = E_NOK;
+        }else{
+            EEPROM_PushBytes(copy_u16Address, ptr_u8Data, copy_u8Length);
+            EEPROM_CommitJob(copy_u16Address, copy_u8Length);
+        }
+
+        SREG = LOC_u8SREG;
+    }
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_IsBusy
+* @brief		:   Checks if the EEPROM is still writing the queued bytes.
+* @return       :   boolean: TRUE until the last queued byte is written.
+======================================================================================================================
+*/
+boolean MCAL_EEPROM_IsBusy(void)
+{
+    return ((Glob_u8JobHead != Glob_u8JobTail) || (EEPROM->EECR & EEPROM_EECR_EEWE_MASK))? TRUE : FALSE;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_ReadRecord
+* @brief		:   Reads the newest valid copy of a record.
+* @param [in]	:   ptr_sRecord: The record, its sequence and active copy are updated for the next write.
+* @param [out]	:   ptr_u8Payload: Buffer to hold the payload.
+* @return       :   eStatus_t: E_OK if a valid copy was found, E_NOK otherwise.
+* @Note         :   Must be called once before the record is written.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_ReadRecord(sEEPROM_Record_t* ptr_sRecord, uint8_t* ptr_u8Payload)
+{
+    eStatus_t status = E_OK;
+    uint16_t LOC_u16SecondCopy;
+    uint8_t LOC_u8FirstSequence;
+    uint8_t LOC_u8SecondSequence;
+    boolean LOC_boolFirstValid;
+    boolean LOC_boolSecondValid;
+
+    if((NULL == ptr_sRecord) || (NULL == ptr_u8Payload) ||
+       !ASSERT_EEPROM_BLOCK(ptr_sRecord->u16Address, EEPROM_RECORD_FOOTPRINT((uint16_t)ptr_sRecord->u8Size)))
+    {
+        status = E_NOK;
+    }else{
+        LOC_u16SecondCopy = ptr_sRecord->u16Address + EEPROM_RECORD_COPY_SIZE((uint16_t)ptr_sRecord->u8Size);
+
+        LOC_boolFirstValid = EEPROM_IsValidCopy(ptr_sRecord->u16Address, ptr_sRecord->u8Size, &LOC_u8FirstSequence);
+        LOC_boolSecondValid = EEPROM_IsValidCopy(LOC_u16SecondCopy, ptr_sRecord->u8Size, &LOC_u8SecondSequence);
+
+        /*The second copy is the newest when it follows the first one or when it's the only valid one*/
+        if((TRUE == LOC_boolSecondValid) &&
+           ((FALSE == LOC_boolFirstValid) || (EEPROM_RECORD_NEXT_SEQUENCE(LOC_u8FirstSequence) == LOC_u8SecondSequence)))
+        {
+            ptr_sRecord->u8ActiveCopy = 1u;
+            ptr_sRecord->u8Sequence = LOC_u8SecondSequence;
+
+        }else if(TRUE == LOC_boolFirstValid){
+
+            ptr_sRecord->u8ActiveCopy = 0u;
+            ptr_sRecord->u8Sequence = LOC_u8FirstSequence;
+        }else{
+            ptr_sRecord->u8ActiveCopy = EEPROM_RECORD_NO_COPY;
+            ptr_sRecord->u8Sequence = EEPROM_RECORD_ERASED_SEQUENCE;
+
+            status = E_NOK;
+        }
+
+        if(E_OK == status)
+        {
+            status = MCAL_EEPROM_Read(((1u == ptr_sRecord->u8ActiveCopy)? LOC_u16SecondCopy : ptr_sRecord->u16Address) +
+                                      EEPROM_RECORD_PAYLOAD_INDEX, ptr_u8Payload, ptr_sRecord->u8Size);
+        }else{
+
+        }
+    }
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EEPROM_WriteRecord
+* @brief		:   Queues a new version of a record to be written over its older copy.
+* @param [in]	:   ptr_sRecord: The record.
+* @param [in]	:   ptr_u8Payload: The new payload.
+* @return       :   eStatus_t: E_OK if the record was queued, E_NOK if there is no room for it.
+* @Note         :   A reset before the copy is written leaves the previous version as the newest valid copy.
+======================================================================================================================
+*/
+eStatus_t MCAL_EEPROM_WriteRecord(sEEPROM_Record_t* ptr_sRecord, const uint8_t* ptr_u8Payload)
+{
+    eStatus_t status = E_OK;
+    uint16_t LOC_u16Address;
+    uint8_t LOC_u8TargetCopy;
+    uint8_t LOC_u8Sequence;
+    uint8_t LOC_u8CRC;
+    uint8_t LOC_u8SREG;
+
+    if((NULL == ptr_sRecord) || (NULL == ptr_u8Payload) ||
+       (EEPROM_RECORD_COPY_SIZE((uint16_t)ptr_sRecord->u8Size) > EEPROM_WRITE_BUFFER_MASK) ||
+       !ASSERT_EEPROM_BLOCK(ptr_sRecord->u16Address, EEPROM_RECORD_FOOTPRINT((uint16_t)ptr_sRecord->u8Size)))
+    {
+        status = E_NOK;
+    }else{
+        LOC_u8TargetCopy = (0u == ptr_sRecord->u8ActiveCopy)? 1u : 0u;
+        LOC_u8Sequence = EEPROM_RECORD_NEXT_SEQUENCE(ptr_sRecord->u8Sequence);
+
+        LOC_u16Address = ptr_sRecord->u16Address +
+                         ((uint16_t)LOC_u8TargetCopy * EEPROM_RECORD_COPY_SIZE((uint16_t)ptr_sRecord->u8Size));
+
+        LOC_u8CRC = EEPROM_CRC8(EEPROM_CRC8_INIT, ptr_u8Payload, ptr_sRecord->u8Size);
+        LOC_u8CRC = EEPROM_CRC8(LOC_u8CRC, &LOC_u8Sequence, 1);
+
+        LOC_u8SREG = SREG;
+        G_INTERRUPT_DISABLE;
+
+        if((EEPROM_RECORD_COPY_SIZE(ptr_sRecord->u8Size) > EEPROM_WRITE_BUFFER_FREE()) || (0u == EEPROM_WRITE_QUEUE_FREE()))
+        {
+            status = E_NOK;
+        }else{
+            /*One block written in address order, the copy only takes the new sequence once the rest is written*/
+            EEPROM_PushBytes(LOC_u16Address + EEPROM_RECORD_PAYLOAD_INDEX, ptr_u8Payload, ptr_sRecord->u8Size);
+            EEPROM_PushBytes(LOC_u16Address + EEPROM_RECORD_CRC_INDEX(ptr_sRecord->u8Size), &LOC_u8CRC, 1);
+            EEPROM_PushBytes(LOC_u16Address + EEPROM_RECORD_SEQUENCE_INDEX(ptr_sRecord->u8Size), &LOC_u8Sequence, 1);
+            EEPROM_CommitJob(LOC_u16Address, EEPROM_RECORD_COPY_SIZE(ptr_sRecord->u8Size));
+
+            /*The blocks are written in order, the next version goes over the copy being replaced now*/
+            ptr_sRecord->u8ActiveCopy = LOC_u8TargetCopy;
+            ptr_sRecord->u8Sequence = LOC_u8Sequence;
+        }
+
+        SREG = LOC_u8SREG;
+    }
+
+    return status;
+}
+
+/**************************************************************************************************************************
+===============================================
+*               EEPROM ISR functions
+*===============================================
+*/
+
+/*EEPROM Ready (Vector number in the datasheet - 1), fires while the EEPROM is ready and the interrupt is enabled*/
+void __vector_17 (void) __attribute__((signal));
+void __vector_17 (void){
+
+    boolean LOC_boolWriting = FALSE;
+    uint8_t LOC_u8Data;
+
+    /*Skip the bytes that already hold their value and start writing the first one that doesn't*/
+    while((Glob_u8JobHead != Glob_u8JobTail) && (FALSE == LOC_boolWriting))
+    {
+        EEPROM->EEAR = Glob_asWriteJobs[Glob_u8JobTail].u16Address + Glob_u8JobOffset;
+
+        LOC_u8Data = Glob_au8WriteBuffer[Glob_u8DataTail];
+        Glob_u8DataTail = (Glob_u8DataTail + 1u) & EEPROM_WRITE_BUFFER_MASK;
+
+        Glob_u8JobOffset++;
+
+        if(Glob_u8JobOffset == Glob_asWriteJobs[Glob_u8JobTail].u8Length)
+        {
+            Glob_u8JobOffset = 0;
+            Glob_u8JobTail = (Glob_u8JobTail + 1u) & EEPROM_WRITE_QUEUE_MASK;
+        }else{
+
+        }
+
+        EEPROM->EECR |= EEPROM_EECR_EERE_MASK;
+
+        if(EEPROM->EEDR != LOC_u8Data)
+        {
+            EEPROM->EEDR = LOC_u8Data;
+
+            /*EEWE must be set within four cycles after EEMWE*/
+            EEPROM->EECR |= EEPROM_EECR_EEMWE_MASK;
+            EEPROM->EECR |= EEPROM_EECR_EEWE_MASK;
+
+            LOC_boolWriting = TRUE;
+        }else{
+
+        }
+    }
+
+    if(Glob_u8JobHead == Glob_u8JobTail)
+    {
+        EEPROM->EECR &= ~(EEPROM_EECR_EERIE_MASK);
+    }else{
+
+    }
+}
@@ -0,0 +1,196 @@
+/**
+**************************************************************************************************************************
+* @brief     : This module contains functions for configuring the external interrupts INT0, INT1 and INT2.
+* @author    : Hossam Eid
+* @date      : 18/10/2026
+**************************************************************************************************************************
+* Description: This file contains the function definitions for the EXTI driver.
+**************************************************************************************************************************
+*/
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Atmega32_EXTI.h"
+
+/** @defgroup Private Macros and defines
+  * @{
+  */
+
+#define EXTI_INT0_PORT          GPIOD
+#define EXTI_INT0_PIN           GPIO_PIN2
+
+#define EXTI_INT1_PORT          GPIOD
+#define EXTI_INT1_PIN           GPIO_PIN3
+
+#define EXTI_INT2_PORT          GPIOB
+#define EXTI_INT2_PIN           GPIO_PIN2
+
+#define EXTI_NUMBER_OF_LINES    3u
+/**
+  * @}
+  */
+
+/** @defgroup Global variables
+  * @{
+  */
+static Ptr_Func Glob_fptrEXTICallback[EXTI_NUMBER_OF_LINES] = {NULL, NULL, NULL};
+
+/*Enable and flag bits of each line in GICR and GIFR, indexed by @ref EXTI_LINE_DEFINE*/
+static const uint8_t Glob_u8EXTIEnableMask[EXTI_NUMBER_OF_LINES] = {EXTI_GICR_INT0_MASK, EXTI_GICR_INT1_MASK,
+                                                                   EXTI_GICR_INT2_MASK};
+static const uint8_t Glob_u8EXTIFlagMask[EXTI_NUMBER_OF_LINES] = {EXTI_GIFR_INTF0_MASK, EXTI_GIFR_INTF1_MASK,
+                                                                 EXTI_GIFR_INTF2_MASK};
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+*===============================================
+*  			APIs functions definitions
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EXTI_Init
+* @brief		:   Configures the pin of the external interrupt line as an input and enables the interrupt
+*                   with the specified trigger.
+* @param [in]	:   EXTICFG: Configuration structure.
+* @return       :   eStatus_t: Status of the function call.
+* @Note         :   A request that was latched before the call is discarded.
+======================================================================================================================
+*/
+eStatus_t MCAL_EXTI_Init(sEXTI_Config_t* EXTICFG)
+{
+    eStatus_t status = E_OK;
+    GPIO_Pin_Config_t LOC_sGPIOCfg;
+    uint8_t LOC_u8SREG;
+
+    if(NULL == EXTICFG)
+    {
+        status = E_NOK;
+
+    }/*Assert all the parameters in the configuration struct*/
+    else if(!ASSERT_EXTI_LINE(EXTICFG->EXTI_Line) || !ASSERT_EXTI_TRIGGER(EXTICFG->EXTI_Line, EXTICFG->EXTI_Trigger)){
+
+        status = E_NOK;
+    }else{
+
+        LOC_sGPIOCfg.pinMode = GPIO_MODE_INPUT_FLOATING;
+
+        LOC_u8SREG = SREG;
+        G_INTERRUPT_DISABLE;
+
+        /*Disable the line while its sense control changes, it may latch a false request*/
+        GICR &= ~(Glob_u8EXTIEnableMask[EXTICFG->EXTI_Line]);
+
+        switch(EXTICFG->EXTI_Line)
+        {
+            case EXTI_INT0:
+                LOC_sGPIOCfg.pinNumber = EXTI_INT0_PIN;
+                MCAL_GPIO_Init(EXTI_INT0_PORT, &LOC_sGPIOCfg);
+
+                MCUCR = (MCUCR & ~EXTI_MCUCR_ISC0_MASK) | ((EXTICFG->EXTI_Trigger) << EXTI_MCUCR_ISC0_POS);
+            break;
+
+            case EXTI_INT1:
+                LOC_sGPIOCfg.pinNumber = EXTI_INT1_PIN;
+                MCAL_GPIO_Init(EXTI_INT1_PORT, &LOC_sGPIOCfg);
+
+                MCUCR = (MCUCR & ~EXTI_MCUCR_ISC1_MASK) | ((EXTICFG->EXTI_Trigger) << EXTI_MCUCR_ISC1_POS);
+            break;
+
+            default: /*EXTI_INT2*/
+                LOC_sGPIOCfg.pinNumber = EXTI_INT2_PIN;
+                MCAL_GPIO_Init(EXTI_INT2_PORT, &LOC_sGPIOCfg);
+
+                if(EXTI_TRIGGER_RISING_EDGE == EXTICFG->EXTI_Trigger)
+                {
+                    MCUCSR |= EXTI_MCUCSR_ISC2_MASK;
+                }else{
+                    MCUCSR &= ~EXTI_MCUCSR_ISC2_MASK;
+                }
+            break;
+        }
+
+        Glob_fptrEXTICallback[EXTICFG->EXTI_Line] = EXTICFG->P_callback_func;
+
+        /*The flag is cleared by writing a logical one to it*/
+        GIFR = Glob_u8EXTIFlagMask[EXTICFG->EXTI_Line];
+        GICR |= Glob_u8EXTIEnableMask[EXTICFG->EXTI_Line];
+
+        SREG = LOC_u8SREG;
+
+        /*Enable the global interrupt*/
+        G_INTERRUPT_ENABLE;
+    }
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EXTI_Disable
+* @brief		:   Disables the specified external interrupt line.
+* @param [in]	:   copy_eLine: The line to disable, must be a value of @ref EXTI_LINE_DEFINE.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_EXTI_Disable(enum EXTI_Line copy_eLine)
+{
+    eStatus_t status = E_OK;
+
+    if(!ASSERT_EXTI_LINE(copy_eLine))
+    {
+        status = E_NOK;
+    }else{
+        GICR &= ~(Glob_u8EXTIEnableMask[copy_eLine]);
+    }
+
+    return status;
+}
+
+/**************************************************************************************************************************
+===============================================
+*               EXTI ISR functions
+*===============================================
+*/
+
+/*External Interrupt Request 0 (Vector number in the datasheet - 1)*/
+void __vector_1 (void) __attribute__((signal));
+void __vector_1 (void){
+
+    if(Glob_fptrEXTICallback[EXTI_INT0])
+    {
+        Glob_fptrEXTICallback[EXTI_INT0]();
+    }else{
+
+    }
+}
+
+/*External Interrupt Request 1*/
+void __vector_2 (void) __attribute__((signal));
+void __vector_2 (void){
+
+    if(Glob_fptrEXTICallback[EXTI_INT1])
+    {
+        Glob_fptrEXTICallback[EXTI_INT1]();
+    }else{
+
+    }
+}
+
+/*External Interrupt Request 2*/
+void __vector_3 (void) __attribute__((signal));
+void __vector_3 (void){
+
+    if(Glob_fptrEXTICallback[EXTI_INT2])
+    {
+        Glob_fptrEXTICallback[EXTI_INT2]();
+    }else{
+
+    }
+}
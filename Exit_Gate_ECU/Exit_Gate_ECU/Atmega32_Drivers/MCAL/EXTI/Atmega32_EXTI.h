@@ -0,0 +1,91 @@
+/**
+**************************************************************************************************************************
+* brief     : This module contains functions for configuring the external interrupts INT0, INT1 and INT2.
+* Author    : Hossam Eid
+* Created on: 18/10/2026
+**************************************************************************************************************************
+* Description: This file contains the function prototypes and definitions for the EXTI driver.
+**************************************************************************************************************************
+*/
+
+#ifndef ATMEGA32_EXTI_H_
+#define ATMEGA32_EXTI_H_
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Atmega32.h"
+#include "GPIO/Atmega32_GPIO.h"
+
+/**************************************************************************************************************************
+*===============================================
+*         Enum Configuration References
+*===============================================
+*/
+
+/*----------- @ref EXTI_LINE_DEFINE ----------------*/
+enum EXTI_Line{
+    EXTI_INT0,                          /*!< External interrupt 0 on PD2*/
+    EXTI_INT1,                          /*!< External interrupt 1 on PD3*/
+    EXTI_INT2                           /*!< External interrupt 2 on PB2 (edges only)*/
+};
+#define ASSERT_EXTI_LINE(line)  ((EXTI_INT0 == line) || (EXTI_INT1 == line) || (EXTI_INT2 == line))
+
+/*----------- @ref EXTI_TRIGGER_MODE ----------------*/
+/*The values are the ISCx1:0 bits of INT0 and INT1*/
+enum EXTI_Trigger{
+    EXTI_TRIGGER_LOW_LEVEL,             /*!< The low level of the pin generates the interrupt (INT0, INT1 only)*/
+    EXTI_TRIGGER_BOTH_EDGES,            /*!< Any logical change on the pin generates the interrupt (INT0, INT1 only)*/
+    EXTI_TRIGGER_FALLING_EDGE,          /*!< The falling edge of the pin generates the interrupt*/
+    EXTI_TRIGGER_RISING_EDGE            /*!< The rising edge of the pin generates the interrupt*/
+};
+#define ASSERT_EXTI_TRIGGER(line, trigger)  (((EXTI_TRIGGER_LOW_LEVEL <= trigger) && (EXTI_TRIGGER_RISING_EDGE >= trigger)) && \
+                                             ((EXTI_INT2 != line) || (EXTI_TRIGGER_FALLING_EDGE <= trigger)))
+
+/**************************************************************************************************************************
+*===============================================
+* User type definitions (structures)
+*===============================================
+*/
+
+typedef struct{
+    enum EXTI_Line      EXTI_Line;              /*!<Specifies the external interrupt line
+                                                This parameter must be a value of @ref EXTI_LINE_DEFINE*/
+
+    enum EXTI_Trigger   EXTI_Trigger;           /*!<Specifies the event that triggers the interrupt
+                                                This parameter must be a value of @ref EXTI_TRIGGER_MODE*/
+
+    Ptr_Func            P_callback_func;        /*!<Function to be executed when the interrupt triggers*/
+}sEXTI_Config_t;
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Supported by "MCAL EXTI DRIVER"
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EXTI_Init
+* @brief		:   Configures the pin of the external interrupt line as an input and enables the interrupt
+*                   with the specified trigger.
+* @param [in]	:   EXTICFG: Configuration structure.
+* @return       :   eStatus_t: Status of the function call.
+* @Note         :   A request that was latched before the call is discarded.
+======================================================================================================================
+*/
+eStatus_t MCAL_EXTI_Init(sEXTI_Config_t* EXTICFG);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_EXTI_Disable
+* @brief		:   Disables the specified external interrupt line.
+* @param [in]	:   copy_eLine: The line to disable, must be a value of @ref EXTI_LINE_DEFINE.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_EXTI_Disable(enum EXTI_Line copy_eLine);
+
+#endif /* ATMEGA32_EXTI_H_ */
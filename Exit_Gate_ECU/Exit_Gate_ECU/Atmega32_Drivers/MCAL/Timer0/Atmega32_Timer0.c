@@ -21,6 +21,9 @@
 
 #define TIMER0_OC0_PORT       GPIOB
 #define TIMER0_OC0_PIN        GPIO_PIN3
+
+/*Number of ticks of one full compare period of the 8-bit counter*/
+#define TIMER0_PERIOD_TICKS   256UL
 /**
   * @}
   */
@@ -31,7 +34,12 @@
 static sTIMER0_Config_t timer0_CFG;
 
 static uint32_t overflowCounter = 0;
-static uint32_t Glob_u32DelayInMilliseconds;
+
+/*Number of full compare periods left before the end of the single interval delay*/
+static volatile uint32_t Glob_u32DelayRemainingPeriods;
+
+/*Prescaler division of each clock source as a power of 2, indexed by @ref TIMER0_CLK_DEFINE*/
+static const uint8_t Glob_u8PrescalerShift[] = {0, 0, 3, 6, 8, 10};
 
 static Ptr_Func overflowCallback;
 static Ptr_Func outputCompareMatchCallback;
@@ -46,22 +54,38 @@ static Ptr_Func Glob_fptrInterruptedDelayCallback;
   */
 static void Timer0_SingleIntervalDelayCallback(void)
 {
-    static uint32_t LOC_u32CTCcounter = 0;
-
-    if(LOC_u32CTCcounter < Glob_u32DelayInMilliseconds)
+    if(Glob_u32DelayRemainingPeriods > 0)
     {
-        LOC_u32CTCcounter++;
-        
-        /*Clear the flag*/
-        SET_BIT(TIFR, TIMER0_TIFR_OCF0_POS);
+        Glob_u32DelayRemainingPeriods--;
+
+        /*The counter was just cleared so it's safe to extend the period to a full one*/
+        TIMER0->OCR0 = (uint8_t)(TIMER0_PERIOD_TICKS - 1);
     }else{
-        LOC_u32CTCcounter = 0;
         MCAL_TIMER0_Stop();
 
         /*Execute the user's function*/
         Glob_fptrInterruptedDelayCallback();
     }
-    
+}
+
+/**
+ * @brief This function converts a delay in milliseconds to timer ticks for the given clock source.
+ * 
+ * @param copy_u32Milliseconds : The delay in milliseconds.
+ * @param copy_u8ClockSource : The prescaled clock source, must be a value of @ref TIMER0_CLK_DEFINE.
+ * @return uint32_t : The number of ticks rounded to the nearest one.
+ * 
+ * @note The whole seconds are converted separately so long delays don't overflow the 32-bit math, the bits of F_CPU
+ *  shifted out by the prescaler are added back with the milliseconds so no error builds up over the seconds.
+ */
+static uint32_t Timer0_MillisecondsToTicks(uint32_t copy_u32Milliseconds, uint8_t copy_u8ClockSource)
+{
+    uint8_t  LOC_u8Shift   = Glob_u8PrescalerShift[copy_u8ClockSource];
+    uint32_t LOC_u32Seconds = copy_u32Milliseconds / 1000UL;
+
+    return (LOC_u32Seconds * (F_CPU >> LOC_u8Shift)) +
+           (((LOC_u32Seconds * (F_CPU & ((1UL << LOC_u8Shift) - 1UL))) +
+             ((copy_u32Milliseconds % 1000UL) * (F_CPU / 1000UL)) + ((1UL << LOC_u8Shift) >> 1)) >> LOC_u8Shift);
 }
 
 /**
@@ -300,27 +324,54 @@ void MCAL_TIMER0_BusyWaitDelayms(uint32_t copy_Milliseconds)
 * @Func_name	: MCAL_TIMER0_SingleIntervalDelayms
 * @brief		  : Function to delay the TIMER0 for a certain amount of time without halting the CPU.
 * @param [in]	: copy_Milliseconds number of milliseconds to delay.
+* @Note       : The smallest prescaler that fits the whole delay in one compare period is used, longer delays
+*               use the largest prescaler and are extended by counting full 256 ticks periods, so a 1000 ms
+*               delay takes 31 interrupts instead of 1000 while staying within a fraction of a millisecond.
 ======================================================================================================================
 */
 void MCAL_TIMER0_SingleIntervalDelayms(uint32_t copy_Milliseconds, Ptr_Func func)
 {
     sTIMER0_Config_t Timer0_cfg;
-    uint8_t LOC_u8CompareValue;
+    uint32_t LOC_u32Ticks;
+    uint32_t LOC_u32FirstPeriodTicks;
+    uint8_t  LOC_u8ClockSource = TIMER0_Prescale_1;
 
-    Timer0_cfg.TIMER0_CLK_SRC = TIMER0_Prescale_64;
+    MCAL_TIMER0_Stop();
+
+    /*Pick the smallest prescaler that fits the delay in a single period for the best resolution*/
+    LOC_u32Ticks = Timer0_MillisecondsToTicks(copy_Milliseconds, LOC_u8ClockSource);
+
+    while((LOC_u32Ticks > TIMER0_PERIOD_TICKS) && (LOC_u8ClockSource < TIMER0_Prescale_1024))
+    {
+        LOC_u8ClockSource++;
+        LOC_u32Ticks = Timer0_MillisecondsToTicks(copy_Milliseconds, LOC_u8ClockSource);
+    }
+
+    if(LOC_u32Ticks == 0)
+    {
+        LOC_u32Ticks = 1;
+    }else{
+
+    }
+
+    /*The remainder runs first while the counter is known to be at zero, then only full periods are counted*/
+    LOC_u32FirstPeriodTicks = ((LOC_u32Ticks - 1) % TIMER0_PERIOD_TICKS) + 1;
+    Glob_u32DelayRemainingPeriods = (LOC_u32Ticks - LOC_u32FirstPeriodTicks) / TIMER0_PERIOD_TICKS;
+
+    Timer0_cfg.TIMER0_CLK_SRC = LOC_u8ClockSource;
     Timer0_cfg.TIMER0_Mode = TIMER0_CTC_Mode;
     Timer0_cfg.TIMER0_COM = TIMER0_COM_Disconnected;
     Timer0_cfg.TIMER0_OCIE = TIMER0_TOCI_Enable;
     Timer0_cfg.TIMER0_OIE = TIMER0_TOI_Disable;
 
-    /*Delay of one millisecond*/
-    LOC_u8CompareValue = (uint8_t)(((F_CPU / 1000) / 64) - 1);
-    MCAL_TIMER0_SetCompare(LOC_u8CompareValue);
+    MCAL_TIMER0_SetCompare((uint8_t)(LOC_u32FirstPeriodTicks - 1));
     MCAL_TIMER0_SetCounter(0x00);
+
+    /*Clear any compare match left from a previous delay so it doesn't fire right away*/
+    SET_BIT(TIFR, TIMER0_TIFR_OCF0_POS);
     
     MCAL_TIMER0_CALLBACK_CompareMatch_INTERRUPT(Timer0_SingleIntervalDelayCallback);    
 
-    Glob_u32DelayInMilliseconds = copy_Milliseconds;
     Glob_fptrInterruptedDelayCallback = func;
     MCAL_TIMER0_Init(&Timer0_cfg);
 }
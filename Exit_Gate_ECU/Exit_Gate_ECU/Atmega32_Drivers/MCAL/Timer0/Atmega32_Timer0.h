@@ -256,6 +256,7 @@ void MCAL_TIMER0_BusyWaitDelayms(uint32_t copy_Milliseconds);
 * @Func_name	: MCAL_TIMER0_SingleIntervalDelayms
 * @brief		  : Function to delay the TIMER0 for a certain amount of time without halting the CPU.
 * @param [in]	: copy_Milliseconds number of milliseconds to delay.
+* @Note       : Long delays take one interrupt every 256 ticks of the largest prescaler (32.768 ms at 8 MHz).
 ======================================================================================================================
 */
 void MCAL_TIMER0_SingleIntervalDelayms(uint32_t copy_Milliseconds, Ptr_Func func);
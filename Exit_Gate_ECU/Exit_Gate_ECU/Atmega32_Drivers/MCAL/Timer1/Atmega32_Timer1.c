@@ -0,0 +1,494 @@
+/**
+**************************************************************************************************************************
+* @brief     : This module contains functions for configuring and controlling the 16-bit Timer1 module.
+* @author    : Hossam Eid
+* @date      : 18/10/2026
+**************************************************************************************************************************
+* Description: This file contains the function definitions for the Timer1 driver and the uptime clock.
+**************************************************************************************************************************
+*/
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Atmega32_Timer1.h"
+
+/** @defgroup Private Macros and defines
+  * @{
+  */
+
+#define TIMER1_OC1A_PORT       GPIOD
+#define TIMER1_OC1A_PIN        GPIO_PIN5
+
+#define TIMER1_OC1B_PORT       GPIOD
+#define TIMER1_OC1B_PIN        GPIO_PIN4
+
+/*Number of ticks of one period in normal mode*/
+#define TIMER1_NORMAL_PERIOD_TICKS      65536UL
+/**
+  * @}
+  */
+
+/** @defgroup Global variables
+  * @{
+  */
+static sTIMER1_Config_t timer1_CFG;
+
+static Ptr_Func overflowCallback = NULL;
+static Ptr_Func outputCompareMatchACallback = NULL;
+static Ptr_Func outputCompareMatchBCallback = NULL;
+
+/** @defgroup Uptime clock, updated by the overflow ISR and read with the interrupts disabled
+  * @{
+  */
+static volatile uint32_t Glob_u32UptimeMicros = 0;
+static volatile uint32_t Glob_u32UptimeMillis = 0;
+
+/*Microseconds not yet counted in the milliseconds (0 - 999)*/
+static volatile uint16_t Glob_u16UptimeMicrosFraction = 0;
+
+/*Length of one TIMER1 period split in milliseconds and microseconds so the ISR needs no division*/
+static uint32_t Glob_u32PeriodTicks = TIMER1_NORMAL_PERIOD_TICKS;
+static uint16_t Glob_u16PeriodMillis = (uint16_t)(TIMER1_NORMAL_PERIOD_TICKS / 1000UL);
+static uint16_t Glob_u16PeriodMicrosRemainder = (uint16_t)(TIMER1_NORMAL_PERIOD_TICKS % 1000UL);
+
+/*TRUE while TIMER1 runs at one tick per microsecond with the overflow interrupt enabled*/
+static volatile boolean Glob_boolClockCounting = FALSE;
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup Local functions
+  * @{
+  */
+
+/**
+ * @brief This function adds a number of microseconds to the uptime clock.
+ * 
+ * @param copy_u32Micros : The elapsed microseconds.
+ * 
+ * @note Must be called with the interrupts disabled.
+ */
+static void Timer1_AdvanceClock(uint32_t copy_u32Micros)
+{
+    Glob_u32UptimeMicros += copy_u32Micros;
+    Glob_u32UptimeMillis += copy_u32Micros / 1000UL;
+    Glob_u16UptimeMicrosFraction += (uint16_t)(copy_u32Micros % 1000UL);
+
+    if(Glob_u16UptimeMicrosFraction >= 1000u)
+    {
+        Glob_u16UptimeMicrosFraction -= 1000u;
+        Glob_u32UptimeMillis++;
+    }else{
+
+    }
+}
+
+/**
+ * @brief This function returns the ticks elapsed in the current period, including an overflow that
+ *  happened but wasn't served yet.
+ * 
+ * @return uint32_t : The elapsed ticks.
+ * 
+ * @note Must be called with the interrupts disabled.
+ */
+static uint32_t Timer1_GetPendingTicks(void)
+{
+    uint32_t LOC_u32Ticks = TIMER1->TCNT1;
+
+    /*A pending overflow with a small counter value means the counter wrapped after the interrupts were disabled*/
+    if(READ_BIT(TIFR, TIMER1_TIFR_TOV1_POS) && (LOC_u32Ticks < (Glob_u32PeriodTicks >> 1)))
+    {
+        LOC_u32Ticks += Glob_u32PeriodTicks;
+    }else{
+
+    }
+
+    return LOC_u32Ticks;
+}
+
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+*===============================================
+*  			APIs functions definitions
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Init
+* @brief		:   Intializes the timer peripheral with the specified parameters in the config struct.
+* @param [in]	:   timerCFG: Configuration structure.
+* @return       :   eStatus_t: Status of the function call.
+* @Note         :   The time elapsed in the current period is added to the uptime clock before the counter is reset,
+*                   so TIMER1 can be reconfigured without the clock going back.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_Init(sTIMER1_Config_t* timerCFG)
+{
+    eStatus_t status = E_OK;
+    uint8_t LOC_u8SREG;
+
+    if(NULL == timerCFG)
+    {
+        status = E_NOK;
+    
+    }/*Assert all the parameters in the configuration struct*/
+    else if(!ASSERT_TIMER1_CLK(timerCFG->TIMER1_CLK_SRC) || !ASSERT_TIMER1_MODE(timerCFG->TIMER1_Mode) ||
+            !ASSERT_TIMER1_COM(timerCFG->TIMER1_COM1A)   || !ASSERT_TIMER1_COM(timerCFG->TIMER1_COM1B)  ||
+            !ASSERT_TIMER1_TOIE(timerCFG->TIMER1_OIE)    || !ASSERT_TIMER1_TOCIE(timerCFG->TIMER1_OCIE)){
+                
+        status = E_NOK;
+    }else{
+
+        LOC_u8SREG = SREG;
+        G_INTERRUPT_DISABLE;
+
+        /*Keep the time elapsed in the current period before resetting the counter*/
+        if(Glob_boolClockCounting)
+        {
+            Timer1_AdvanceClock(Timer1_GetPendingTicks());
+        }else{
+
+        }
+
+        /*Store the configuration struct for later use*/
+        timer1_CFG = * timerCFG;
+
+        /*Stop the timer while it's being configured*/
+        TIMER1->TCCR1B = 0;
+
+        TIMER1->TCCR1A = ((timerCFG->TIMER1_COM1A) << TIMER1_TCCRA_COM1A_POS) |
+                         ((timerCFG->TIMER1_COM1B) << TIMER1_TCCRA_COM1B_POS) |
+                         ((timerCFG->TIMER1_Mode) & (TIMER1_TCCRA_WGM10_MASK | TIMER1_TCCRA_WGM11_MASK));
+
+        if(TIMER1_Normal_Mode == timerCFG->TIMER1_Mode)
+        {
+            Glob_u32PeriodTicks = TIMER1_NORMAL_PERIOD_TICKS;
+        }else{
+            TIMER1->ICR1 = timerCFG->TIMER1_Top;
+
+            Glob_u32PeriodTicks = (uint32_t)timerCFG->TIMER1_Top + 1UL;
+        }
+
+        Glob_u16PeriodMillis = (uint16_t)(Glob_u32PeriodTicks / 1000UL);
+        Glob_u16PeriodMicrosRemainder = (uint16_t)(Glob_u32PeriodTicks % 1000UL);
+
+        TIMER1->TCNT1 = 0;
+
+        /*Clear the pending flags*/
+        TIFR = TIMER1_TIFR_TOV1_MASK | TIMER1_TIFR_OCF1A_MASK | TIMER1_TIFR_OCF1B_MASK;
+
+        /*Clear the interrupt mask bits*/
+        TIMSK &= ~(TIMER1_TIMSK_TOIE1_MASK | TIMER1_TIMSK_OCIE1A_MASK | TIMER1_TIMSK_OCIE1B_MASK);
+        TIMSK |= ((timerCFG->TIMER1_OIE) | (timerCFG->TIMER1_OCIE));
+
+        Glob_boolClockCounting = ((TIMER1_UPTIME_CLK_SRC == timerCFG->TIMER1_CLK_SRC) &&
+                                  (TIMER1_TOI_Enable == timerCFG->TIMER1_OIE))? TRUE : FALSE;
+
+        /*
+        *   the Data Direction Register (DDR) bit corresponding to the OC1x 
+        *   pin must be set in order to enable the output driver.
+        */
+        if(TIMER1_COM_Disconnected != timerCFG->TIMER1_COM1A)
+        {
+            GPIO_Pin_Config_t cfg = {TIMER1_OC1A_PIN, GPIO_MODE_OUTPUT};
+            MCAL_GPIO_Init(TIMER1_OC1A_PORT, &cfg);
+        }
+
+        if(TIMER1_COM_Disconnected != timerCFG->TIMER1_COM1B)
+        {
+            GPIO_Pin_Config_t cfg = {TIMER1_OC1B_PIN, GPIO_MODE_OUTPUT};
+            MCAL_GPIO_Init(TIMER1_OC1B_PORT, &cfg);
+        }
+
+        /*Start the timer*/
+        TIMER1->TCCR1B = ((((timerCFG->TIMER1_Mode) >> 2) << TIMER1_TCCRB_WGM12_POS) & 
+                          (TIMER1_TCCRB_WGM12_MASK | TIMER1_TCCRB_WGM13_MASK)) |
+                         (timerCFG->TIMER1_CLK_SRC);
+
+        SREG = LOC_u8SREG;
+
+        if((TIMER1_TOCI_Disable != timerCFG->TIMER1_OCIE) || (TIMER1_TOI_Enable == timerCFG->TIMER1_OIE))
+        {
+            /*Enable the global interrupt*/
+            G_INTERRUPT_ENABLE;
+        }      
+    }
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Stop
+* @brief		:   Stop the Timer peripheral from counting.
+* @Note         :   This function doesn't reset the peripheral it only stops the counting process.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_Stop()
+{
+    eStatus_t status = E_OK;
+
+    /*Disable the clock to stop the timer*/
+    TIMER1->TCCR1B &= ~(TIMER1_TCCRB_CS_MASK);
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	  :   MCAL_TIMER1_Start
+* @brief		    :   start the counter from the same value we Stopped at.
+* @Note         :   none.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_Start()
+{
+    eStatus_t status = E_OK;
+
+    /*Enable the clock to start the timer*/
+    TIMER1->TCCR1B |= timer1_CFG.TIMER1_CLK_SRC;
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_SetCompareA
+* @brief		:   Set the value of the output compare register A.
+* @param [in]	:   compareVal: The value to be set.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_SetCompareA(uint16_t compareVal)
+{
+    eStatus_t status = E_OK;
+    uint8_t LOC_u8SREG = SREG;
+
+    /*The 16-bit write goes through the TEMP register shared with the ISRs*/
+    G_INTERRUPT_DISABLE;
+    TIMER1->OCR1A = compareVal;
+    SREG = LOC_u8SREG;
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_SetCompareB
+* @brief		:   Set the value of the output compare register B.
+* @param [in]	:   compareVal: The value to be set.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_SetCompareB(uint16_t compareVal)
+{
+    eStatus_t status = E_OK;
+    uint8_t LOC_u8SREG = SREG;
+
+    /*The 16-bit write goes through the TEMP register shared with the ISRs*/
+    G_INTERRUPT_DISABLE;
+    TIMER1->OCR1B = compareVal;
+    SREG = LOC_u8SREG;
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_GetCounter
+* @brief		:   Get the value stored in the counter register.
+* @param [out]	:   counterVal: pointer to store the returned value in.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_GetCounter(uint16_t* counterVal)
+{
+    eStatus_t status = E_OK;
+    uint8_t LOC_u8SREG = SREG;
+
+    /*The 16-bit read goes through the TEMP register shared with the ISRs*/
+    G_INTERRUPT_DISABLE;
+    *counterVal = TIMER1->TCNT1;
+    SREG = LOC_u8SREG;
+
+    return status;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_StartUptimeClock
+* @brief		:   Starts TIMER1 free-running at one tick per microsecond to keep the uptime clock.
+* @Note         :   Any later configuration keeps the clock running as long as it uses TIMER1_UPTIME_CLK_SRC
+*                   with the overflow interrupt enabled.
+======================================================================================================================
+*/
+void MCAL_TIMER1_StartUptimeClock(void)
+{
+    sTIMER1_Config_t Timer1_cfg;
+
+    Timer1_cfg.TIMER1_CLK_SRC = TIMER1_UPTIME_CLK_SRC;
+    Timer1_cfg.TIMER1_Mode = TIMER1_Normal_Mode;
+    Timer1_cfg.TIMER1_COM1A = TIMER1_COM_Disconnected;
+    Timer1_cfg.TIMER1_COM1B = TIMER1_COM_Disconnected;
+    Timer1_cfg.TIMER1_OIE = TIMER1_TOI_Enable;
+    Timer1_cfg.TIMER1_OCIE = TIMER1_TOCI_Disable;
+    Timer1_cfg.TIMER1_Top = 0;
+
+    MCAL_TIMER1_Init(&Timer1_cfg);
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Millis
+* @brief		:   Returns the number of milliseconds since the uptime clock was started.
+* @return       :   uint32_t: Uptime in milliseconds, wraps after 49.7 days.
+* @Note         :   Safe to call from the main loop and from ISRs, compare the results with @ref TIMER1_TIME_COMPARISON.
+======================================================================================================================
+*/
+uint32_t MCAL_TIMER1_Millis(void)
+{
+    uint32_t LOC_u32Millis;
+    uint32_t LOC_u32Micros = 0;
+    uint8_t  LOC_u8SREG = SREG;
+
+    G_INTERRUPT_DISABLE;
+
+    LOC_u32Millis = Glob_u32UptimeMillis;
+
+    if(Glob_boolClockCounting)
+    {
+        LOC_u32Micros = Glob_u16UptimeMicrosFraction + Timer1_GetPendingTicks();
+    }else{
+
+    }
+
+    SREG = LOC_u8SREG;
+
+    return LOC_u32Millis + (LOC_u32Micros / 1000UL);
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Micros
+* @brief		:   Returns the number of microseconds since the uptime clock was started.
+* @return       :   uint32_t: Uptime in microseconds, wraps after 71.5 minutes.
+* @Note         :   Safe to call from the main loop and from ISRs, compare the results with @ref TIMER1_TIME_COMPARISON.
+======================================================================================================================
+*/
+uint32_t MCAL_TIMER1_Micros(void)
+{
+    uint32_t LOC_u32Micros;
+    uint8_t  LOC_u8SREG = SREG;
+
+    G_INTERRUPT_DISABLE;
+
+    LOC_u32Micros = Glob_u32UptimeMicros;
+
+    if(Glob_boolClockCounting)
+    {
+        LOC_u32Micros += Timer1_GetPendingTicks();
+    }else{
+
+    }
+
+    SREG = LOC_u8SREG;
+
+    return LOC_u32Micros;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_CALLBACK_Overflow_INTERRUPT
+* @brief		:   Set the overflow interrupt callback function.
+* @param [in]	:   callback: the overflow interrupt callback function, NULL for none.
+======================================================================================================================
+*/
+void MCAL_TIMER1_CALLBACK_Overflow_INTERRUPT(Ptr_Func callback)
+{
+    overflowCallback = callback;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_CALLBACK_CompareMatchA_INTERRUPT
+* @brief		:   Set the output compare match A interrupt callback function.
+* @param [in]	:   callback: the output compare match A interrupt callback function.
+======================================================================================================================
+*/
+void MCAL_TIMER1_CALLBACK_CompareMatchA_INTERRUPT(Ptr_Func callback)
+{
+    outputCompareMatchACallback = callback;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_CALLBACK_CompareMatchB_INTERRUPT
+* @brief		:   Set the output compare match B interrupt callback function.
+* @param [in]	:   callback: the output compare match B interrupt callback function.
+======================================================================================================================
+*/
+void MCAL_TIMER1_CALLBACK_CompareMatchB_INTERRUPT(Ptr_Func callback)
+{
+    outputCompareMatchBCallback = callback;
+}
+
+
+/**************************************************************************************************************************
+===============================================
+*               Timer1 ISR functions
+*===============================================
+*/
+
+/*Timer/Counter1 Compare Match A (Vector number in the datasheet - 1)*/
+void __vector_7 (void) __attribute__((signal));
+void __vector_7 (void){
+    
+    outputCompareMatchACallback();
+}
+
+/*Timer/Counter1 Compare Match B*/
+void __vector_8 (void) __attribute__((signal));
+void __vector_8 (void){
+    
+    outputCompareMatchBCallback();
+}
+
+/*Timer/Counter1 Overflow*/
+void __vector_9 (void) __attribute__((signal));
+void __vector_9 (void){
+
+    if(Glob_boolClockCounting)
+    {
+        Glob_u32UptimeMicros += Glob_u32PeriodTicks;
+        Glob_u32UptimeMillis += Glob_u16PeriodMillis;
+        Glob_u16UptimeMicrosFraction += Glob_u16PeriodMicrosRemainder;
+
+        if(Glob_u16UptimeMicrosFraction >= 1000u)
+        {
+            Glob_u16UptimeMicrosFraction -= 1000u;
+            Glob_u32UptimeMillis++;
+        }else{
+
+        }
+    }else{
+
+    }
+
+    if(overflowCallback)
+    {
+        overflowCallback();
+    }else{
+
+    }
+}
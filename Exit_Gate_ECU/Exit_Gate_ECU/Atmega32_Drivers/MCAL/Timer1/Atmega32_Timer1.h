@@ -0,0 +1,292 @@
+/**
+**************************************************************************************************************************
+* brief     : This module contains functions for configuring and controlling the 16-bit TIMER1 module.
+* Author    : Hossam Eid
+* Created on: 18/10/2026
+**************************************************************************************************************************
+* Description: This file contains the function prototypes and definitions for the TIMER1 driver, the driver also
+*              keeps the system uptime clock (millis / micros) running from the TIMER1 overflows.
+**************************************************************************************************************************
+*/
+
+#ifndef ATMEGA32_TIMER1_H_
+#define ATMEGA32_TIMER1_H_
+
+/*
+*===============================================
+*                   Includes
+*===============================================
+*/
+#include "Atmega32.h"
+#include "GPIO/Atmega32_GPIO.h"
+
+/**************************************************************************************************************************
+*===============================================
+*         Enum Configuration References
+*===============================================
+*/
+
+/*----------- @ref TIMER1_CLK_DEFINE ----------------*/
+enum TIMER1_CLK_SRC{
+    TIMER1_no_CLK_SRC,                   /*!< No clock source (TIMER1/Counter stopped).*/   
+    TIMER1_Prescale_1,                   /*!< clkI/O/1 (No prescaling)*/
+    TIMER1_Prescale_8,                   /*!< clkI/O/8 (From prescaler)*/
+    TIMER1_Prescale_64,                  /*!< clkI/O/64 (From prescaler)*/
+    TIMER1_Prescale_256,                 /*!< clkI/O/256 (From prescaler)*/
+    TIMER1_Prescale_1024,                /*!< clkI/O/1024 (From prescaler)*/
+    TIMER1_EXT_CLK_Falling,              /*!< External clock source on T1 pin. Clock on falling edge.*/
+    TIMER1_EXT_CLK_Rising                /*!< External clock source on T1 pin. Clock on rising edge.*/
+};
+#define ASSERT_TIMER1_CLK(CLK)  (TIMER1_no_CLK_SRC <= CLK &&  \
+                               (TIMER1_EXT_CLK_Rising >= CLK))
+
+/*The clock source giving one tick per microsecond, the uptime clock only counts while TIMER1 runs on it*/
+#if (F_CPU == 8000000UL)
+#define TIMER1_UPTIME_CLK_SRC   TIMER1_Prescale_8
+#elif (F_CPU == 1000000UL)
+#define TIMER1_UPTIME_CLK_SRC   TIMER1_Prescale_1
+#else
+#error "The TIMER1 uptime clock needs F_CPU to be 1 MHz or 8 MHz"
+#endif
+
+/*----------- @ref TIMER1_DEFINE_MODE ----------------*/
+/*The values are the WGM13:0 bits of the mode*/
+enum TIMER1_Mode{
+    TIMER1_Normal_Mode          = 0,                     /*!< TIMER1 in normal operating mode, TOP = 0xFFFF*/   
+    TIMER1_CTC_ICR1_Mode        = 12,                    /*!< TIMER1 in Clear On Compare Match mode, TOP = ICR1*/
+    TIMER1_FAST_PWM_ICR1_Mode   = 14                     /*!< TIMER1 in fast PWM mode, TOP = ICR1*/
+};
+#define ASSERT_TIMER1_MODE(mode) ((TIMER1_Normal_Mode          == mode)    || \
+                                 (TIMER1_CTC_ICR1_Mode        == mode)    || \
+                                 (TIMER1_FAST_PWM_ICR1_Mode   == mode))
+
+
+/*----------- @ref TIMER1_COM_DEFINE ----------------*/
+/** @defgroup Non-PWM Mode
+  * @{
+  */
+ /**
+ * TIMER1_COM                    Description
+ * TIMER1_COM_Disconnected : Normal port operation, OC1x disconnected.
+ * TIMER1_COM_Toggle       : Toggle OC1x on Compare Match
+ * TIMER1_COM_Clear        : Clear OC1x on Compare Match
+ * TIMER1_COM_Set          : Set OC1x on Compare Match
+ */
+/**
+  * @}
+  */
+
+/** @defgroup Fast PWM mode
+  * @{
+  */
+ /**
+ * TIMER1_COM                    Description
+ * TIMER1_COM_Disconnected : Normal port operation, OC1x disconnected.
+ * TIMER1_COM_Clear        : Clear OC1x on Compare Match, set OC1x at BOTTOM, (non-inverting mode)
+ * TIMER1_COM_Set          : Set OC1x on Compare Match, clear OC1x at BOTTOM, (inverting mode)
+ */
+/**
+  * @}
+  */
+
+enum TIMER1_COM{
+    TIMER1_COM_Disconnected,                 /*!< Normal port operation, OC1x disconnected*/   
+    TIMER1_COM_Toggle,                       /*!< Toggle OC1x on Compare Match*/
+    TIMER1_COM_Clear,                        /*!< Clear OC1x on Compare Match */
+    TIMER1_COM_Set                           /*!< Set OC1x on Compare Match */
+};
+#define ASSERT_TIMER1_COM(com)  ((TIMER1_COM_Disconnected <= com) && (TIMER1_COM_Set >= com))
+
+
+/*----------- @ref TIMER1_TOIE_DEFINE ----------------*/
+enum TIMER1_TOIE{
+    TIMER1_TOI_Disable,                                              /*!< TIMER1 Overflow interrupt disable */
+    TIMER1_TOI_Enable = TIMER1_TIMSK_TOIE1_MASK,                     /*!< TIMER1 Overflow interrupt enable*/   
+};
+#define ASSERT_TIMER1_TOIE(TOIE) ((TIMER1_TOI_Disable == TOIE)     || \
+                                 (TIMER1_TOI_Enable  == TOIE))
+
+
+/*----------- @ref TIMER1_TOCIE_DEFINE ----------------*/
+enum TIMER1_TOCIE{
+    TIMER1_TOCI_Disable,                                          /*!< TIMER1 Output compare match interrupts disable */
+    TIMER1_TOCIA_Enable  = TIMER1_TIMSK_OCIE1A_MASK,              /*!< TIMER1 Output compare match A interrupt enable*/   
+    TIMER1_TOCIB_Enable  = TIMER1_TIMSK_OCIE1B_MASK,              /*!< TIMER1 Output compare match B interrupt enable*/   
+    TIMER1_TOCIAB_Enable = (TIMER1_TIMSK_OCIE1A_MASK |            /*!< TIMER1 Output compare match A & B interrupts enable*/  
+                            TIMER1_TIMSK_OCIE1B_MASK) 
+};
+
+#define ASSERT_TIMER1_TOCIE(TOCIE) ((TIMER1_TOCI_Disable  == TOCIE)     || \
+                                  (TIMER1_TOCIA_Enable  == TOCIE)     || \
+                                  (TIMER1_TOCIB_Enable  == TOCIE)     || \
+                                  (TIMER1_TOCIAB_Enable == TOCIE))
+
+/**************************************************************************************************************************
+*===============================================
+*         Uptime clock helpers
+*===============================================
+*/
+/** @defgroup TIMER1_TIME_COMPARISON
+  * @brief  Wrap-safe comparisons of timestamps returned by MCAL_TIMER1_Millis / MCAL_TIMER1_Micros,
+  *         they stay correct across the 32-bit wrap as long as the compared times are less than 2^31 apart.
+  * @{
+  */
+#define TIMER1_TIME_ELAPSED(now, start)         ((uint32_t)((uint32_t)(now) - (uint32_t)(start)))
+#define TIMER1_TIME_IS_AFTER(a, b)              ((sint32_t)((uint32_t)(b) - (uint32_t)(a)) < 0)
+#define TIMER1_TIME_IS_REACHED(now, deadline)   ((sint32_t)((uint32_t)(now) - (uint32_t)(deadline)) >= 0)
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+*===============================================
+* User type definitions (structures)
+*===============================================
+*/
+
+typedef struct{
+    enum TIMER1_CLK_SRC  TIMER1_CLK_SRC;        /*!<Specifies the input clock source of the TIMER1
+                                            This parameter must be a value of @ref TIMER1_CLK_DEFINE*/
+
+    enum TIMER1_Mode   TIMER1_Mode;             /*Specifies the operation mode of the TIMER1 peripheral
+                                            This parameter must be a value of @ref TIMER1_DEFINE_MODE*/
+
+    enum TIMER1_COM   TIMER1_COM1A;            /*Specifies the output compare pin (OC1A - PD5) behavior
+                                            This parameter must be a value of @ref TIMER1_COM_DEFINE*/   
+
+    enum TIMER1_COM   TIMER1_COM1B;            /*Specifies the output compare pin (OC1B - PD4) behavior
+                                            This parameter must be a value of @ref TIMER1_COM_DEFINE*/   
+
+    enum TIMER1_TOIE  TIMER1_OIE;              /*Specifies if the overflow interrupt should be enabled
+                                            This parameter   must be a value of @ref TIMER1_TOIE_DEFINE*/  
+   
+    enum TIMER1_TOCIE TIMER1_OCIE;             /*Specifies which output compare match interrupts should be enabled 
+                                            This parameter must be a value of @ref TIMER1_TOCIE_DEFINE*/  
+
+    uint16_t          TIMER1_Top;              /*Specifies the TOP value (ICR1) of the ICR1 modes, ignored in normal mode*/
+}sTIMER1_Config_t;
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Supported by "MCAL TIMER1 DRIVER"
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Init
+* @brief		  :   Intializes the TIMER1 peripheral with the specified parameters in the config struct.
+* @param [in]	:   TIMER1CFG: Configuration structure.
+* @return     :   eStatus_t: Status of the function call.
+* @Note       :   The time elapsed in the current period is added to the uptime clock before the counter is reset,
+*                 so TIMER1 can be reconfigured without the clock going back.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_Init(sTIMER1_Config_t* TIMER1CFG);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Stop
+* @brief		:   Stop the TIMER1 peripheral from counting.
+* @Note         :   This function doesn't reset the peripheral it only stops the counting process.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_Stop();
+
+/**
+======================================================================================================================
+* @Func_name	  :   MCAL_TIMER1_Start
+* @brief		    :   start the counter from the same value we Stopped at.
+* @Note         :   none.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_Start();
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_SetCompareA
+* @brief		:   Set the value of the output compare register A.
+* @param [in]	:   compareVal: The value to be set.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_SetCompareA(uint16_t compareVal);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_SetCompareB
+* @brief		:   Set the value of the output compare register B.
+* @param [in]	:   compareVal: The value to be set.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_SetCompareB(uint16_t compareVal);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_GetCounter
+* @brief		:   Get the value stored in the counter register.
+* @param [out]	:   counterVal: pointer to store the returned value in.
+* @return       :   eStatus_t: Status of the function call.
+======================================================================================================================
+*/
+eStatus_t MCAL_TIMER1_GetCounter(uint16_t* counterVal);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_StartUptimeClock
+* @brief		:   Starts TIMER1 free-running at one tick per microsecond to keep the uptime clock.
+* @Note         :   Any later configuration keeps the clock running as long as it uses TIMER1_UPTIME_CLK_SRC
+*                   with the overflow interrupt enabled.
+======================================================================================================================
+*/
+void MCAL_TIMER1_StartUptimeClock(void);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Millis
+* @brief		:   Returns the number of milliseconds since the uptime clock was started.
+* @return       :   uint32_t: Uptime in milliseconds, wraps after 49.7 days.
+* @Note         :   Safe to call from the main loop and from ISRs, compare the results with @ref TIMER1_TIME_COMPARISON.
+======================================================================================================================
+*/
+uint32_t MCAL_TIMER1_Millis(void);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_Micros
+* @brief		:   Returns the number of microseconds since the uptime clock was started.
+* @return       :   uint32_t: Uptime in microseconds, wraps after 71.5 minutes.
+* @Note         :   Safe to call from the main loop and from ISRs, compare the results with @ref TIMER1_TIME_COMPARISON.
+======================================================================================================================
+*/
+uint32_t MCAL_TIMER1_Micros(void);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_CALLBACK_Overflow_INTERRUPT
+* @brief		:   Set the overflow interrupt callback function.
+* @param [in]	:   callback: the overflow interrupt callback function, NULL for none.
+======================================================================================================================
+*/
+void MCAL_TIMER1_CALLBACK_Overflow_INTERRUPT(Ptr_Func callback);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_CALLBACK_CompareMatchA_INTERRUPT
+* @brief		:   Set the output compare match A interrupt callback function.
+* @param [in]	:   callback: the output compare match A interrupt callback function.
+======================================================================================================================
+*/
+void MCAL_TIMER1_CALLBACK_CompareMatchA_INTERRUPT(Ptr_Func callback);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_TIMER1_CALLBACK_CompareMatchB_INTERRUPT
+* @brief		:   Set the output compare match B interrupt callback function.
+* @param [in]	:   callback: the output compare match B interrupt callback function.
+======================================================================================================================
+*/
+void MCAL_TIMER1_CALLBACK_CompareMatchB_INTERRUPT(Ptr_Func callback);
+
+#endif /* ATMEGA32_TIMER1_H_ */
@@ -23,6 +23,17 @@
 
 #include "Atmega32.h"
 
+/**************************************************************************************************************************
+*===============================================
+*         Transmit Buffer Configuration
+*===============================================
+*/
+/**
+ * @brief Size of the transmit ring buffer drained by the UDRE interrupt, must be a power of 2 not larger than 128
+ *        one slot is always kept empty to tell a full buffer from an empty one.
+ */
+#define USART_TX_BUFFER_SIZE        32u
+
 /**************************************************************************************************************************
 *===============================================
 *         Configuration References
@@ -34,9 +45,11 @@
  * 
  * @brief This enum specifies the configuration for the USART module clock (Asynchronous - Synchronous)
  * 
- * @param USART_CLKOP_NormalAsynch : Normal operation mode for the USART with no use of a clock and normal speed.
+ * @param USART_CLKOP_NormalAsynch : Normal operation mode for the USART with no use of a clock, the speed mode
+ *                                   is the one selected by @ref USART_BAUD_CONFIG_DEFINE.
  * 
- * @param USART_CLKOP_2xSpeedAsynch: Normal operation mode for the USART with no use of a clock and double speed. 
+ * @param USART_CLKOP_2xSpeedAsynch: Same as USART_CLKOP_NormalAsynch, kept for compatibility as the double speed
+ *                                   mode is selected by @ref USART_BAUD_CONFIG_DEFINE. 
  * 
  * @param USART_CLKOP_Synch  : synchronous operation for the USART with a clock generated from xCKn pin.
  *  
@@ -67,6 +80,7 @@ typedef enum{
     USART_BAUD_RATE_2400     = 2400,
     USART_BAUD_RATE_9600     = 9600,
     USART_BAUD_RATE_19200    = 19200,
+    USART_BAUD_RATE_38400    = 38400,
     USART_BAUD_RATE_57600    = 57600,
     USART_BAUD_RATE_115200   = 115200,
     USART_BAUD_RATE_230400   = 230400,
@@ -76,6 +90,56 @@ typedef enum{
     USART_BAUD_RATE_4500000  = 4500000
 }eUSART_BaudRate_t;
 
+/**
+ * @ref USART_BAUD_CONFIG_DEFINE
+ * 
+ * @brief These macros compute the UBRR value and the speed mode at compile time from F_CPU and the baud rate,
+ *        so MCAL_UART_Init doesn't need any division on the AVR.
+ * 
+ * @note  USART_BAUD_CONFIG picks the speed mode (normal or U2X) with the smallest error and breaks the build
+ *        (negative array size) if that error is above USART_MAX_BAUD_ERROR_PERMILLE or UBRR doesn't fit in 12 bits.
+ * 
+ * @note  With the gates' 8 MHz clock the asynchronous rates that build are 2400 to 38400 baud (38400: U2X, 0.2%).
+ *        57600 (2.1%) and 115200 (3.5%) are refused, they need a baud friendly crystal such as 7.3728 MHz, which
+ *        the TIMER1 uptime clock and the 1 ms TIMER0/TIMER2 ticks don't support yet as they need a whole number
+ *        of timer ticks per microsecond and per millisecond.
+ */
+#define USART_MAX_BAUD_ERROR_PERMILLE       20UL        /**!<2% maximum baud rate error*/
+
+#define USART_BAUD_CONFIG_U2X_FLAG          0x8000u     /**!<Set when the double speed mode is needed*/
+#define USART_BAUD_CONFIG_UBRR_MASK         0x0FFFu
+
+#define USART_UBRR_MAX                      4095UL
+
+/*UBRR rounded to the nearest value for the clock divisor (16 normal, 8 double speed, 2 synchronous)*/
+#define USART_UBRR_ROUND(BAUD, DIV)         ((((F_CPU) + (((DIV) * (BAUD)) / 2UL)) / ((DIV) * (BAUD))) - 1UL)
+
+#define USART_ACTUAL_BAUD(BAUD, DIV)        ((F_CPU) / ((DIV) * (USART_UBRR_ROUND(BAUD, DIV) + 1UL)))
+
+#define USART_BAUD_ERROR_PERMILLE(BAUD, DIV)                                                    \
+            ((((USART_ACTUAL_BAUD(BAUD, DIV) > (BAUD))? (USART_ACTUAL_BAUD(BAUD, DIV) - (BAUD)) :  \
+                                                       ((BAUD) - USART_ACTUAL_BAUD(BAUD, DIV))) * 1000UL) / (BAUD))
+
+#define USART_BAUD_USE_2X(BAUD)             (USART_BAUD_ERROR_PERMILLE(BAUD, 8UL) < USART_BAUD_ERROR_PERMILLE(BAUD, 16UL))
+
+#define USART_BAUD_DIVISOR(BAUD)            (USART_BAUD_USE_2X(BAUD)? 8UL : 16UL)
+
+#define USART_BAUD_IS_VALID(BAUD, DIV)      ((USART_BAUD_ERROR_PERMILLE(BAUD, DIV) <= USART_MAX_BAUD_ERROR_PERMILLE) && \
+                                             (USART_UBRR_ROUND(BAUD, DIV) <= USART_UBRR_MAX))
+
+/*Fails to compile when the condition is false, usable inside an expression*/
+#define USART_STATIC_ASSERT_EXPR(COND)      (0u * sizeof(char[(COND)? 1 : -1]))
+
+/*Baud rate configuration for the asynchronous modes*/
+#define USART_BAUD_CONFIG(BAUD)                                                                 \
+            ((uint16_t)(USART_STATIC_ASSERT_EXPR(USART_BAUD_IS_VALID(BAUD, USART_BAUD_DIVISOR(BAUD))) + \
+                        USART_UBRR_ROUND(BAUD, USART_BAUD_DIVISOR(BAUD)) +                      \
+                        (USART_BAUD_USE_2X(BAUD)? USART_BAUD_CONFIG_U2X_FLAG : 0u)))
+
+/*Baud rate configuration for the synchronous mode*/
+#define USART_BAUD_CONFIG_SYNCH(BAUD)                                                           \
+            ((uint16_t)(USART_STATIC_ASSERT_EXPR(USART_BAUD_IS_VALID(BAUD, 2UL)) + USART_UBRR_ROUND(BAUD, 2UL)))
+
 /**
  * @ref USART_DEFINE_WORD
  * 
@@ -153,8 +217,9 @@ typedef struct{
     eUSART_TXRX_t               USART_Mode;            /** Specifies the operating mode of the USART (TX - RX - TXRX)
                                                         must be set based on @ref USART_MODE_DEFINE*/
 
-    eUSART_BaudRate_t           USART_baudRate;       /** Specifies the operating baud rate of the USART 
-                                                        must be set based on @ref UART_BAUD_RATE_DEFINE*/ 
+    uint16_t                    USART_baudRate;       /** Specifies the operating baud rate of the USART 
+                                                        must be set using @ref USART_BAUD_CONFIG_DEFINE
+                                                        with a baud rate from @ref UART_BAUD_RATE_DEFINE*/ 
 
     eUSART_WordLenght_t         USART_wordLength;     /** Specifies the data word length of the USART payload 
                                                         must be set based on @ref USART_DEFINE_WORD*/
@@ -197,7 +262,7 @@ void MCAL_UART_RESET();
 ======================================================================================================================
 * @Func_name	:   MCAL_UART_Disable
 * @brief		:   Function to disable the UART TX and RX channels.
-* @note			:   none
+* @note			:   The TX channel is disabled after the transmit buffer is drained.
 ======================================================================================================================
 */
 void MCAL_UART_Disable();
@@ -243,11 +308,24 @@ eStatus_t MCAL_UART_Get_Data(uint16_t* pRxBuffer, eUSART_PollingMode_t PollingEn
 * @param [in]	:   string to send.
 * @param [out]	:   none.
 * @return       :   none.
-* @note			:   This function works with the polling mechanism.
+* @note			:   The string is queued in the transmit buffer, the function only waits when the buffer is full.
 ======================================================================================================================
 */
 void MCAL_USART_Send_String(uint8_t* string);
 
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_UART_Write
+* @brief		:   Queues a block of bytes in the transmit buffer to be sent by the UDRE interrupt.
+* @param [in]	:   pu8Buffer: pointer to the bytes to be sent.
+* @param [in]	:   u8Length: number of bytes to be sent.
+* @return       :   eStatus_t: E_OK if all the bytes were queued, E_NOK if there is no room for them (nothing is queued).
+* @note			:   This function never waits for the hardware, it's safe to call from the main loop and from ISRs.
+*               :   The UDRE interrupt is owned by the transmit buffer while it's draining.
+======================================================================================================================
+*/
+eStatus_t MCAL_UART_Write(const uint8_t* pu8Buffer, uint8_t u8Length);
+
 /**
 ======================================================================================================================
 * @Func_name	:   MCAL_USART_Get_String
@@ -57,6 +57,9 @@
 /*---------------------------Timer0-----------------------------*/
 #define Timer0_BASE     (uint8_t)(PERIPHERAL_MEMORY_BASE + 0x32)
 
+/*---------------------------Timer1-----------------------------*/
+#define Timer1_BASE     (uint8_t)(PERIPHERAL_MEMORY_BASE + 0x26)
+
 /*---------------------------Timer2-----------------------------*/
 #define Timer2_BASE     (uint8_t)(PERIPHERAL_MEMORY_BASE + 0x22)
 
@@ -66,6 +69,9 @@
 /*---------------------------USART-----------------------------*/
 #define USART_BASE      (uint8_t)(PERIPHERAL_MEMORY_BASE + 0x09)
 
+/*---------------------------EEPROM-----------------------------*/
+#define EEPROM_BASE     (uint8_t)(PERIPHERAL_MEMORY_BASE + 0x1C)
+
 /*================================================================
 *-*-*-*-*-*-*-*-*-*-*-*-
   System registers:
@@ -108,6 +114,17 @@ typedef struct{
     vuint8_t OCR0;                  /*Timer0 output compare Register*/
 }Timer0_typedef;
 
+/*The 16-bit registers are accessed through the shared TEMP register, avr-gcc writes the high byte first
+  and reads the low byte first so a 16-bit access from C is safe unless an ISR accesses Timer1 in between*/
+typedef struct{
+    vuint16_t ICR1;                 /*Timer1 Input Capture Register*/
+    vuint16_t OCR1B;                /*Timer1 Output Compare Register B*/
+    vuint16_t OCR1A;                /*Timer1 Output Compare Register A*/
+    vuint16_t TCNT1;                /*Timer1 count Register*/
+    vuint8_t  TCCR1B;               /*Timer1 Control Register B*/
+    vuint8_t  TCCR1A;               /*Timer1 Control Register A*/
+}Timer1_typedef;
+
 typedef struct{
     vuint8_t ASSR;                  /*Timer2 Asynchronous Status Register*/
     vuint8_t OCR2;                  /*Timer2 output compare Register*/
@@ -122,6 +139,12 @@ typedef struct{
     vuint8_t  ADMUX;                /*ADC Multiplexer Selection Register*/
 }ADC_typedef;
 
+typedef struct{
+    vuint8_t  EECR;                 /*EEPROM Control Register*/
+    vuint8_t  EEDR;                 /*EEPROM Data Register*/
+    vuint16_t EEAR;                 /*EEPROM Address Register*/
+}EEPROM_typedef;
+
 
 #define WDTCR   *((volatile uint8_t *)(PERIPHERAL_MEMORY_BASE + 0x21))  /*Watchdog Timer Control Register*/
 
@@ -133,6 +156,11 @@ typedef struct{
                                                                           provides information on which reset source
                                                                           caused an MCU Reset*/
 
+/*-------------------------External Interrupts Registers---------------------------*/
+#define MCUCR   *((volatile uint8_t *)(PERIPHERAL_MEMORY_BASE + 0x35))  /*MCU Control Register (INT0, INT1 sense control)*/
+#define GICR    *((volatile uint8_t *)(PERIPHERAL_MEMORY_BASE + 0x3B))  /*General Interrupt Control Register*/
+#define GIFR    *((volatile uint8_t *)(PERIPHERAL_MEMORY_BASE + 0x3A))  /*General Interrupt Flag Register*/
+
 /*================================================================*/
 //-*-*-*-*-*-*-*-*-*-*-*-
 //Peripheral Instants:
@@ -150,7 +178,10 @@ typedef struct{
 /*----------------Timer0-----------------------*/
 #define TIMER0  ((Timer0_typedef *)(Timer0_BASE))
 
-/*----------------Timer0-----------------------*/
+/*----------------Timer1-----------------------*/
+#define TIMER1  ((Timer1_typedef *)(Timer1_BASE))
+
+/*----------------Timer2-----------------------*/
 #define TIMER2  ((Timer2_typedef *)(Timer2_BASE))
 
 /*----------------ADC-----------------------*/
@@ -162,6 +193,9 @@ typedef struct{
 #define USART_UBRRH   *((volatile uint8_t *)(PERIPHERAL_MEMORY_BASE + 0x20))  /*USART Baud Rate Register High*/
 #define USART_UCSRC   *((volatile uint8_t *)(PERIPHERAL_MEMORY_BASE + 0x20))  /*USART control/status Register C*/
 
+/*-----------------EEPROM------------------------*/
+#define EEPROM  ((EEPROM_typedef *)(EEPROM_BASE))
+
 /*================================================================*/
 //-*-*-*-*-*-*-*-*-*-*-*-
 //Generic Macros:
@@ -227,6 +261,36 @@ typedef struct{
   * @}
   */
 
+/*---------------------Timer1------------------------*/
+
+/** @defgroup TCCR1A
+  * @{
+  */
+#define TIMER1_TCCRA_WGM10_POS      0
+#define TIMER1_TCCRA_WGM10_MASK     (1 << TIMER1_TCCRA_WGM10_POS)
+#define TIMER1_TCCRA_WGM11_POS      1
+#define TIMER1_TCCRA_WGM11_MASK     (1 << TIMER1_TCCRA_WGM11_POS)
+#define TIMER1_TCCRA_COM1B_POS      4
+#define TIMER1_TCCRA_COM1B_MASK     (3 << TIMER1_TCCRA_COM1B_POS)
+#define TIMER1_TCCRA_COM1A_POS      6
+#define TIMER1_TCCRA_COM1A_MASK     (3 << TIMER1_TCCRA_COM1A_POS)
+/**
+  * @}
+  */
+
+/** @defgroup TCCR1B
+  * @{
+  */
+#define TIMER1_TCCRB_CS_POS         0
+#define TIMER1_TCCRB_CS_MASK        (7 << TIMER1_TCCRB_CS_POS)
+#define TIMER1_TCCRB_WGM12_POS      3
+#define TIMER1_TCCRB_WGM12_MASK     (1 << TIMER1_TCCRB_WGM12_POS)
+#define TIMER1_TCCRB_WGM13_POS      4
+#define TIMER1_TCCRB_WGM13_MASK     (1 << TIMER1_TCCRB_WGM13_POS)
+/**
+  * @}
+  */
+
 /*---------------------Timer2------------------------*/
 
 /** @defgroup TCCR0
@@ -262,6 +326,13 @@ typedef struct{
 #define TIMER0_TIMSK_OCIE0_POS         1
 #define TIMER0_TIMSK_OCIE0_MASK        (1 << TIMER0_TIMSK_OCIE0_POS)
 
+#define TIMER1_TIMSK_TOIE1_POS         2
+#define TIMER1_TIMSK_TOIE1_MASK        (1 << TIMER1_TIMSK_TOIE1_POS)
+#define TIMER1_TIMSK_OCIE1B_POS        3
+#define TIMER1_TIMSK_OCIE1B_MASK       (1 << TIMER1_TIMSK_OCIE1B_POS)
+#define TIMER1_TIMSK_OCIE1A_POS        4
+#define TIMER1_TIMSK_OCIE1A_MASK       (1 << TIMER1_TIMSK_OCIE1A_POS)
+
 #define TIMER2_TIMSK_TOIE2_POS         6
 #define TIMER2_TIMSK_TOIE2_MASK        (1 << TIMER2_TIMSK_TOIE2_POS)
 #define TIMER2_TIMSK_OCIE2_POS         7
@@ -280,11 +351,77 @@ typedef struct{
 #define TIMER0_TIFR_OCF0_POS          1
 #define TIMER0_TIFR_OCF0_MASK         (1 << TIMER0_TIFR_OCF0_POS)
 
+#define TIMER1_TIFR_TOV1_POS          2
+#define TIMER1_TIFR_TOV1_MASK         (1 << TIMER1_TIFR_TOV1_POS)
+#define TIMER1_TIFR_OCF1B_POS         3
+#define TIMER1_TIFR_OCF1B_MASK        (1 << TIMER1_TIFR_OCF1B_POS)
+#define TIMER1_TIFR_OCF1A_POS         4
+#define TIMER1_TIFR_OCF1A_MASK        (1 << TIMER1_TIFR_OCF1A_POS)
+
 #define TIMER2_TIFR_TOV2_POS          6
 #define TIMER2_TIFR_TOV2_MASK         (1 << TIMER2_TIFR_TOV2_POS)
 #define TIMER2_TIFR_OCF2_POS          7
 #define TIMER2_TIFR_OCF2_MASK         (1 << TIMER2_TIFR_OCF2_POS)
 
+/**
+  * @}
+  */
+
+/*---------------------External Interrupts------------------------*/
+
+/** @defgroup MCUCR
+  * @{
+  */
+#define EXTI_MCUCR_ISC0_POS              0
+#define EXTI_MCUCR_ISC0_MASK             (3 << EXTI_MCUCR_ISC0_POS)     /*!< INT0 sense control*/
+#define EXTI_MCUCR_ISC1_POS              2
+#define EXTI_MCUCR_ISC1_MASK             (3 << EXTI_MCUCR_ISC1_POS)     /*!< INT1 sense control*/
+/**
+  * @}
+  */
+
+/** @defgroup MCUCSR
+  * @{
+  */
+#define EXTI_MCUCSR_ISC2_POS             6
+#define EXTI_MCUCSR_ISC2_MASK            (1 << EXTI_MCUCSR_ISC2_POS)    /*!< INT2 sense control*/
+/**
+  * @}
+  */
+
+/** @defgroup GICR / GIFR
+  * @{
+  */
+#define EXTI_GICR_INT2_POS               5
+#define EXTI_GICR_INT2_MASK              (1 << EXTI_GICR_INT2_POS)
+#define EXTI_GICR_INT0_POS               6
+#define EXTI_GICR_INT0_MASK              (1 << EXTI_GICR_INT0_POS)
+#define EXTI_GICR_INT1_POS               7
+#define EXTI_GICR_INT1_MASK              (1 << EXTI_GICR_INT1_POS)
+
+#define EXTI_GIFR_INTF2_POS              5
+#define EXTI_GIFR_INTF2_MASK             (1 << EXTI_GIFR_INTF2_POS)
+#define EXTI_GIFR_INTF0_POS              6
+#define EXTI_GIFR_INTF0_MASK             (1 << EXTI_GIFR_INTF0_POS)
+#define EXTI_GIFR_INTF1_POS              7
+#define EXTI_GIFR_INTF1_MASK             (1 << EXTI_GIFR_INTF1_POS)
+/**
+  * @}
+  */
+
+/*---------------------EEPROM------------------------*/
+
+/** @defgroup EECR
+  * @{
+  */
+#define EEPROM_EECR_EERE_POS             0
+#define EEPROM_EECR_EERE_MASK            (1 << EEPROM_EECR_EERE_POS)    /*!< EEPROM Read Enable*/
+#define EEPROM_EECR_EEWE_POS             1
+#define EEPROM_EECR_EEWE_MASK            (1 << EEPROM_EECR_EEWE_POS)    /*!< EEPROM Write Enable*/
+#define EEPROM_EECR_EEMWE_POS            2
+#define EEPROM_EECR_EEMWE_MASK           (1 << EEPROM_EECR_EEMWE_POS)   /*!< EEPROM Master Write Enable*/
+#define EEPROM_EECR_EERIE_POS            3
+#define EEPROM_EECR_EERIE_MASK           (1 << EEPROM_EECR_EERIE_POS)   /*!< EEPROM Ready Interrupt Enable*/
 /**
   * @}
   */
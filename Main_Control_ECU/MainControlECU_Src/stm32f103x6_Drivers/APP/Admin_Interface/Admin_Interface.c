@@ -35,6 +35,22 @@
   */
 
 #define TIMEOUT_10_SECONDS         4 /*Specify the timeout period using formula ((time / 2) - 1)*/
+
+/** @defgroup IDS_INDEX
+  * @brief Open addressing hash index of the authorized IDs list, it holds the list positions so the gates
+  * requests are checked from the SPI ISR. It's rebuilt after every change of the list.
+  * @{
+  */
+#define IDS_INDEX_SIZE             16u      /*A power of 2 at least twice AUTHORIZED_IDS_MAX_COUNT to keep the probes short*/
+#define IDS_INDEX_MASK             (IDS_INDEX_SIZE - 1u)
+#define IDS_INDEX_EMPTY            0xFFu
+
+#if ((IDS_INDEX_SIZE & IDS_INDEX_MASK) != 0u) || (IDS_INDEX_SIZE < (2u * AUTHORIZED_IDS_MAX_COUNT))
+#error "IDS_INDEX_SIZE must be a power of 2 at least twice AUTHORIZED_IDS_MAX_COUNT"
+#endif
+/**
+  * @}
+  */
 /**
   * @}
   */
@@ -107,6 +123,10 @@ static uint8 Glob_DriversIDsList[AUTHORIZED_IDS_MAX_COUNT][AUTHORIZED_ID_SIZE +
 static uint8 Glob_AuthIDsCount = 3;
 
 static uint8 Glob_szAuthorizationRequestDriverID[AUTHORIZED_ID_SIZE + 1];
+
+/*Read by the gates SPI ISRs, invalid while the list is being changed*/
+static volatile uint8 Glob_au8IDsIndex[IDS_INDEX_SIZE];
+static volatile boolean Glob_boolIDsIndexValid = FALSE;
 /**
   * @}
   */
@@ -184,6 +204,60 @@ static void st_Admin_DisplayAddNewIDMessage(void)
   }
 }
 
+/**
+======================================================================================================================
+* @Func_name	: AI_HashID
+* @brief		  : Function to get the index slot an ID is looked up from.
+* @param [in]	: ptr_DriverID: array of AUTHORIZED_ID_SIZE characters holding the Driver ID.
+* @return     : The first slot to probe.
+======================================================================================================================
+*/
+static uint8 AI_HashID(const uint8* ptr_DriverID)
+{
+  uint8 LOC_u8Hash = 0;
+  uint8 LOC_u8Index;
+
+  for(LOC_u8Index = 0; LOC_u8Index < AUTHORIZED_ID_SIZE; LOC_u8Index++)
+  {
+    LOC_u8Hash = (uint8)((LOC_u8Hash * 31u) + ptr_DriverID[LOC_u8Index]);
+  }
+
+  return (LOC_u8Hash & IDS_INDEX_MASK);
+}
+
+/**
+======================================================================================================================
+* @Func_name	: AI_BuildIDsIndex
+* @brief		  : Function to rebuild the hash index from the IDs list.
+* Note			  : The index must be invalidated before the list is changed.
+======================================================================================================================
+*/
+static void AI_BuildIDsIndex(void)
+{
+  uint8 LOC_u8Counter;
+  uint8 LOC_u8Slot;
+
+  for(LOC_u8Slot = 0; LOC_u8Slot < IDS_INDEX_SIZE; LOC_u8Slot++)
+  {
+    Glob_au8IDsIndex[LOC_u8Slot] = IDS_INDEX_EMPTY;
+  }
+
+  for(LOC_u8Counter = 0; LOC_u8Counter < Glob_AuthIDsCount; LOC_u8Counter++)
+  {
+    LOC_u8Slot = AI_HashID(Glob_DriversIDsList[LOC_u8Counter]);
+
+    /*Linear probing, the index is never more than half full*/
+    while(Glob_au8IDsIndex[LOC_u8Slot] != IDS_INDEX_EMPTY)
+    {
+      LOC_u8Slot = (LOC_u8Slot + 1u) & IDS_INDEX_MASK;
+    }
+
+    Glob_au8IDsIndex[LOC_u8Slot] = LOC_u8Counter;
+  }
+
+  Glob_boolIDsIndexValid = TRUE;
+}
+
 /**
 ======================================================================================================================
 * @Func_name	: st_Admin_AddedIDsuccessfully
@@ -193,11 +267,18 @@ static void st_Admin_DisplayAddNewIDMessage(void)
 */
 static void st_Admin_AddedIDsuccessfully(void)
 {
+   Glob_boolIDsIndexValid = FALSE;
+
    /*Copy the ID into the main list*/
    strcpy((sint8 *)Glob_DriversIDsList[Glob_AuthIDsCount], (const sint8 *)Glob_tempDriverIDinput);
 
    /*Increase the IDs count in the system*/
    Glob_AuthIDsCount++;
+
+   AI_BuildIDsIndex();
+
+   /*Push the new ID to the gates*/
+   AI_GC_AuthorizedIDAdded(Glob_tempDriverIDinput);
    
    LCD_Clear_Screen();
 
@@ -270,6 +351,8 @@ static void st_Admin_IDnotFound(void)
 */
 static void deleteID(uint8 IDindex)
 {
+  Glob_boolIDsIndexValid = FALSE;
+
   /*If the ID to be deleted is in the end of the list just decrease the IDs count*/
   if(IDindex < Glob_AuthIDsCount - 1)
   {
@@ -280,6 +363,8 @@ static void deleteID(uint8 IDindex)
   }
 
   Glob_AuthIDsCount--;
+
+  AI_BuildIDsIndex();
 }
 
 /**
@@ -308,6 +393,9 @@ static void st_Admin_CheckRepeatedID(void)
       Admin_Dashboard_State = st_Admin_IDalreadyExists;
     }else if(currentOperation == ADMIN_REMOVE_ID)
     {
+      /*Revoke the ID on the gates*/
+      AI_GC_AuthorizedIDRemoved(Glob_tempDriverIDinput);
+
       deleteID(counter);
       Admin_Dashboard_State = st_Admin_RemovedIDsuccessfully;
     }else{
@@ -418,6 +506,9 @@ void st_Admin_DashboardInit(void)
   
   Keypad_Init();
 
+  /*The gates requests are authenticated through the queue until the index is built*/
+  AI_BuildIDsIndex();
+
   /*Set the next state*/
   Admin_Dashboard_State = st_Admin_InitialMessage;
 }
@@ -885,6 +976,68 @@ void AI_GC_SendIDForAuthentication(uint8* ptr_DriverID)
    /*Copy the driver ID to be authorized*/
    strcpy((sint8  *)Glob_szAuthorizationRequestDriverID, (const sint8  *)ptr_DriverID);
 }
+
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_LookupID
+* @brief		   :  Function to check an ID against the list of authorized IDs through its hash index.
+* @param [in]	:  ptr_DriverID: array of AUTHORIZED_ID_SIZE characters holding the Driver ID.
+* @return     :  Must be a value of @ref AUTHORIZED_ID_LOOKUP.
+* @note			:  Takes a few compares whatever the size of the list, it's safe to call from an ISR.
+======================================================================================================================
+*/
+uint8 AI_GC_LookupID(const uint8* ptr_DriverID)
+{
+   uint8 LOC_u8Result = AI_LOOKUP_NOT_FOUND;
+   uint8 LOC_u8Slot = AI_HashID(ptr_DriverID);
+   uint8 LOC_u8Position;
+
+   /*The list is only changed from the main loop, it can't change while an ISR reads it*/
+   if(Glob_boolIDsIndexValid == FALSE)
+   {
+      LOC_u8Result = AI_LOOKUP_UNAVAILABLE;
+   }else{
+      LOC_u8Position = Glob_au8IDsIndex[LOC_u8Slot];
+
+      while((LOC_u8Position != IDS_INDEX_EMPTY) && (LOC_u8Result == AI_LOOKUP_NOT_FOUND))
+      {
+         if(memcmp(Glob_DriversIDsList[LOC_u8Position], ptr_DriverID, AUTHORIZED_ID_SIZE) == 0)
+         {
+            LOC_u8Result = AI_LOOKUP_FOUND;
+         }else{
+            LOC_u8Slot = (LOC_u8Slot + 1u) & IDS_INDEX_MASK;
+            LOC_u8Position = Glob_au8IDsIndex[LOC_u8Slot];
+         }
+      }
+   }
+
+   return LOC_u8Result;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_GetAuthorizedID
+* @brief		   :  Function to read an ID from the list of authorized IDs.
+* @param [in]	:  copy_u8Index: index of the ID in the list.
+* @param [out]	:  ptr_DriverID: array of AUTHORIZED_ID_SIZE characters to copy the ID into.
+* @return     :  E_OK if the index is in the list, E_NOK otherwise.
+* @note			:  The order of the list changes when an ID is removed.
+======================================================================================================================
+*/
+eStatus_t AI_GC_GetAuthorizedID(uint8 copy_u8Index, uint8* ptr_DriverID)
+{
+   eStatus_t LOC_eStatus = E_NOK;
+
+   if(copy_u8Index < Glob_AuthIDsCount)
+   {
+      memcpy(ptr_DriverID, Glob_DriversIDsList[copy_u8Index], AUTHORIZED_ID_SIZE);
+      LOC_eStatus = E_OK;
+   }else{
+
+   }
+
+   return LOC_eStatus;
+}
 /**
   * @}
   */
\ No newline at end of file
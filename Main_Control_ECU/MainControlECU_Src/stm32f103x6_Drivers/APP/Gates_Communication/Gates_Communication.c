@@ -36,168 +36,1240 @@
   * @}
   */
 
+/** @defgroup GATE_RESULT_DETAIL
+  * @brief A result frame is {result, slots left, detail}, the detail byte packs the reason of a refusal
+  * in its high nibble and the message the gate shows in its low nibble. At the SPI clock of 1 MHz 
+  * each byte of the frame takes 8 us.
+  * @{
+  */
+#define GATE_RESULT_REASON_NONE             0x0u
+#define GATE_RESULT_REASON_NOT_AUTHORIZED   0x1u
+#define GATE_RESULT_REASON_RATE_LIMITED     0x2u
+#define GATE_RESULT_REASON_GARAGE_FULL      0x3u
+
+#define GATE_RESULT_MSG_NONE                0x0u
+#define GATE_RESULT_MSG_WELCOME             0x1u
+#define GATE_RESULT_MSG_GOODBYE             0x2u
+#define GATE_RESULT_MSG_CONTACT_ADMIN       0x3u
+
+#define GATE_RESULT_DETAIL(REASON, MSG)     ((uint8)(((REASON) << 4) | ((MSG) & 0x0Fu)))
+/**
+  * @}
+  */
+
+/** @defgroup GATE_REPLY
+  * @brief Every authentication request is answered right away with one of these replies before its result,
+  * the reply frame is {code, argument, 0} like the result frame. The codes never match a gate address.
+  * @{
+  */
+#define GATE_REPLY_ACCEPTED             0xA1u       /**!<The request is queued, the argument is its position in the queue>*/
+#define GATE_REPLY_BUSY                 0xB5u       /**!<The queue is full, the argument is the retry delay in GATE_REPLY_RETRY_UNIT_MS>*/
+#define GATE_REPLY_WAITLISTED           0x5Au       /**!<The ID is valid but the garage is full, the argument is the place in the waiting list>*/
+#define GATE_REPLY_ADMITTED             0xADu       /**!<A slot is free for the waiting driver, sent like a passed result>*/
+
+#define GATE_REPLY_RETRY_UNIT_MS        10u
+#define GATE_REPLY_BUSY_RETRY_AFTER     20u         /**!<About the time to serve one request>*/
+
+#define GATE_RESULT_CODE_INDEX          0
+#define GATE_RESULT_ARGUMENT_INDEX      1
+#define GATE_RESULT_DETAIL_INDEX        2
+#define GATE_RESULT_FRAME_SIZE          3
+/**
+  * @}
+  */
+
 /** @defgroup GATES_ECUS_ADDRESSES
   * @{
   */
 #define ENTRANCE_GATE_ECU_ADDRESS       0xE7u
 #define ENTRANCE_GATE_ECU_SPI           SPI1
 
-#define EXIT_GATE_ECU_ADDRESS           0x7Eu
-#define EXIT_GATE_ECU_SPI               SPI2
+#define EXIT_GATE_ECU_ADDRESS           0x7Eu
+#define EXIT_GATE_ECU_SPI               SPI2
+/**
+  * @}
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup GATE_LINK_FRAME
+  * @{
+  */
+#define GATE_FRAME_START_BYTE           0xFFu       /**!<Sent when a gate asks for attention to start the ID frame>*/
+#define GATE_FRAME_CACHE_START_BYTE     0xC3u       /**!<Sent to start a cache update frame>*/
+#define GATE_FRAME_DUMMY_BYTE           0x00u       /**!<Sent to clock the next byte out of the gate ECU>*/
+#define MAX_FAILED_TRANSMISSIONS        10
+#define SYNC_MAX_BUS_RETRIES            1           /**!<Resending the sync byte after a bus error is harmless*/
+#define DATA_MAX_BUS_RETRIES            0           /**!<The gate can't replay the data bytes so the frame is dropped*/
+/**
+  * @}
+  */
+
+/** @defgroup GATE_LINK_STATES
+  * @{
+  */
+#define GATE_LINK_IDLE                  0           /**!<No transfer in flight, the SPI interrupts are quiet>*/
+#define GATE_LINK_RECEIVING_ID          1           /**!<Receiving an ID frame from the gate*/
+#define GATE_LINK_SENDING_RESULT        2           /**!<Sending the authentication result to the gate*/
+#define GATE_LINK_SENDING_CACHE_UPDATE  3           /**!<Sending an update of the allow-list to the gate cache*/
+/**
+  * @}
+  */
+
+/** @defgroup GATE_REQUEST_FRAME
+  * @brief A request frame is {request type, gate cache version, driver ID}.
+  * @{
+  */
+#define GATE_REQUEST_TYPE_INDEX         0
+#define GATE_REQUEST_VERSION_INDEX      1
+#define GATE_REQUEST_HEADER_SIZE        2
+
+/*Request types*/
+#define GATE_REQUEST_AUTHENTICATE       0x01u       /**!<The gate waits for the authentication result*/
+#define GATE_REQUEST_ENTRY_NOTIFY       0x02u       /**!<The gate found the ID in its cache and already opened*/
+#define GATE_REQUEST_CACHE_SYNC         0x03u       /**!<The gate asks to confirm its cache is up to date, the ID is unused*/
+#define GATE_REQUEST_OFFLINE_ENTRY      0x04u       /**!<The gate replays a vehicle it let pass while this ECU was unreachable*/
+/**
+  * @}
+  */
+
+/** @defgroup GATE_FAIL_BUCKET
+  * @brief Every gate has a token bucket of failed authentications, a failure takes a token and a gate with
+  * no tokens left has its authentication requests refused right away without looking the ID up.
+  * A token is given back every GATE_FAIL_REFILL_MS measured on the DWT cycle counter, the main loop
+  * refills both buckets so the counter can't wrap between two refills, see MCAL_DWT_GetCycles.
+  * @{
+  */
+#define GATE_FAIL_BUCKET_SIZE           3u          /**!<Failures a gate may have in a row>*/
+#define GATE_FAIL_REFILL_MS             2000u       /**!<Time per token given back>*/
+/**
+  * @}
+  */
+
+/** @defgroup GATE_CACHE_OPERATIONS
+  * @brief A cache update frame is {operation, allow-list version, driver ID}, the gates apply an
+  * ADD or REMOVE only on top of the previous version and LOAD only on the same version.
+  * @{
+  */
+#define GATE_CACHE_OP_SYNC              0x01u       /**!<Confirms the version, the ID is unused>*/
+#define GATE_CACHE_OP_ADD               0x02u       /**!<Adds the ID and moves to the version>*/
+#define GATE_CACHE_OP_REMOVE            0x03u       /**!<Removes the ID and moves to the version>*/
+#define GATE_CACHE_OP_CLEAR             0x04u       /**!<Empties the cache and moves to the version>*/
+#define GATE_CACHE_OP_LOAD              0x05u       /**!<Adds an ID of the current list after a clear>*/
+#define GATE_CACHE_OP_OCCUPANCY         0x06u       /**!<Carries the places left in the first ID byte, the version is unused>*/
+
+#define GATE_CACHE_FRAME_OP_INDEX       0
+#define GATE_CACHE_FRAME_VERSION_INDEX  1
+#define GATE_CACHE_FRAME_ID_INDEX       2
+#define GATE_CACHE_FRAME_SIZE           (GATE_CACHE_FRAME_ID_INDEX + AUTHORIZED_ID_SIZE)
+
+/*Number of updates kept to bring a lagging gate up to date, older gates are cleared and reloaded*/
+#define GATE_CACHE_LOG_SIZE             4
+
+/*Version 0 means the cache was never synchronized, it's skipped when the version wraps*/
+#define GATE_CACHE_VERSION_UNSYNCED     0u
+#define GATE_CACHE_NEXT_VERSION(VER)    (((VER) == 0xFFu)? 1u : (uint8)((VER) + 1u))
+
+#define GATE_CACHE_NO_SNAPSHOT          0xFFu
+/**
+  * @}
+  */
+
+/** @defgroup GATE_WAITLIST
+  * @brief A valid entrance driver arriving while no slot is free waits in this list, the driver is sent
+  * the admission as soon as a slot frees up and leaves the list once the gate notifies the entry.
+  * The entrance gate sends nothing while its driver waits, so the list holds one driver and a new
+  * request of the gate replaces a driver the gate gave up on.
+  * The indices are free running and the list is empty when they are equal.
+  * @{
+  */
+#define GATE_WAITLIST_SIZE              1u
+#define GATE_WAITLIST_MASK              (GATE_WAITLIST_SIZE - 1u)
+#define GATE_WAITLIST_TIMEOUT_MS        295000u     /**!<The gate gives up on the driver after 300 s>*/
+#define GATE_ADMISSION_RETRY_MS         1000u       /**!<Time to wait for the entry notification before sending the admission again>*/
+
+#if ((GATE_WAITLIST_SIZE & GATE_WAITLIST_MASK) != 0u) || (GATE_WAITLIST_SIZE > 128u)
+#error "GATE_WAITLIST_SIZE must be a power of 2 not larger than 128"
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup GATE_OCCUPANCY
+  * @brief The entrance gate is told when the garage becomes full or not full, it refuses the entries
+  * on its own while the garage is full. The garage is only full for the gate once a driver waits
+  * for the next slot, the pushed number is GatesComm_EntrancePlaces.
+  * @{
+  */
+#define GATE_OCCUPANCY_UNKNOWN          0u          /**!<Nothing was pushed since the gate started>*/
+#define GATE_OCCUPANCY_NOT_FULL         1u
+#define GATE_OCCUPANCY_FULL             2u
+/**
+  * @}
+  */
+
+/** @defgroup Local Defines
+  * @{
+  */
+
+/**
+ * @brief Holds the context of the SPI link with one of the gates ECUs.
+ * 
+ * A frame starts with a sync transaction of one byte repeated until the gate answers with its address,
+ * then the data transaction exchanges the driver ID or the authentication result.
+ */
+typedef struct
+{
+    volatile SPI_Typedef* SPIx;         /**!<SPI instance connected to the gate ECU>*/
+    uint8 u8GateAddress;                /**!<Address the gate ECU answers with at the start of the frame>*/
+    uint8 u8EXTI_IVT_index;             /**!<Interrupt of the EXTI line the gate uses to ask for attention>*/
+    volatile uint8 u8LinkState;         /**!<Must be a value of @ref GATE_LINK_STATES>*/
+    uint8 u8FailedTransmissions;        /**!<Number of sync bytes the gate didn't answer with its address>*/
+    uint8 u8SyncTxByte;                 /**!<Byte sent in the sync transaction>*/
+    uint8 u8SyncRxByte;                 /**!<Byte received in the sync transaction>*/
+    uint8 au8ResultFrame[GATE_RESULT_FRAME_SIZE];   /**!<@ref AUTHENTICATION_RESULT or @ref GATE_REPLY to be sent>*/
+    sSPI_Transaction_t sSyncTransaction;
+    sSPI_Transaction_t sDataTransaction;
+    sGateRequestInfo_t sRequest;        /**!<The request being received>*/
+    uint8 au8RequestFrame[GATE_REQUEST_HEADER_SIZE + AUTHORIZED_ID_SIZE];
+    volatile boolean boolAttentionPending;  /**!<The gate asked for attention while the link was busy>*/
+    uint8 u8CacheVersion;               /**!<Version of the gate cache as last reported by the gate or pushed to it>*/
+    boolean boolCacheLoaded;            /**!<The cache was cleared and loaded since this ECU started>*/
+    boolean boolCachePushEnabled;       /**!<FALSE until the gate reports its version and after a push fails>*/
+    boolean boolCacheSyncRequested;     /**!<The gate asked to confirm its cache version>*/
+    uint8 u8SnapshotIndex;              /**!<Next list index to load into the cache, GATE_CACHE_NO_SNAPSHOT if none>*/
+    uint8 au8CacheFrame[GATE_CACHE_FRAME_SIZE];
+    volatile uint8 u8ReportedVehicles;  /**!<Vehicles the gate let pass, counted by the SPI ISR or with the verdict>*/
+    volatile uint8 u8CountedVehicles;   /**!<Reported vehicles already applied to the available slots>*/
+    uint8 u8PendingRequests;            /**!<Authentication requests of the gate queued or being served>*/
+    uint8 au8LastRequestID[AUTHORIZED_ID_SIZE];     /**!<ID of the last request queued for the gate>*/
+    uint8 u8FailTokensUsed;             /**!<Tokens taken from the failures bucket, the bucket is empty at GATE_FAIL_BUCKET_SIZE>*/
+    uint32 u32FailRefillStamp;          /**!<Value of the cycle counter the bucket is refilled up to>*/
+    uint8 u8PushedOccupancy;            /**!<Occupancy last pushed to the entrance gate, @ref GATE_OCCUPANCY>*/
+}sGateLink_t;
+
+/**
+ * @brief Holds an update of the allow-list to be pushed to the gates caches.
+ * 
+ */
+typedef struct
+{
+    uint8 u8Operation;                  /**!<Must be a value of @ref GATE_CACHE_OPERATIONS>*/
+    uint8 u8Version;                    /**!<Version of the allow-list after the update>*/
+    uint8 au8DriverID[AUTHORIZED_ID_SIZE];
+}sCacheUpdate_t;
+/**
+  * @}
+  */
+
+/** @defgroup Local Variables
+  * @{
+  */
+
+/**
+ * @brief Queue to hold all the requests from the 2 gates to be processed
+ *  by following the First In First Out schema.
+ * 
+ */
+static sFIFO_Buf_t Glob_sQueueBuffer;
+static sGateRequestInfo_t Glob_szGatesRequests[MAX_NUMBER_OF_REQUESTS];
+
+static sGateLink_t Glob_sEntranceGateLink = {ENTRANCE_GATE_ECU_SPI, ENTRANCE_GATE_ECU_ADDRESS, NVIC_EXTI4_IVT_INDEX, GATE_LINK_IDLE};
+static sGateLink_t Glob_sExitGateLink = {EXIT_GATE_ECU_SPI, EXIT_GATE_ECU_ADDRESS, NVIC_EXTI15_10_IVT_INDEX, GATE_LINK_IDLE};
+
+/**
+ * @brief Holds the address of the gate which has a request currenlty being processed.
+ * 
+ */
+static uint8 Glob_u8ServedRequestGateAddress;
+static uint8 Glob_au8ServedRequestID[AUTHORIZED_ID_SIZE];
+
+/**
+ * @brief Waiting list of the valid entrance drivers, filled by the entrance SPI ISR or the main loop
+ * and emptied by the main loop, the entrance SPI ISR clears it when the gate sends a new request.
+ * 
+ */
+static uint8 Glob_au8Waitlist[GATE_WAITLIST_SIZE][AUTHORIZED_ID_SIZE];
+static uint32 Glob_au32WaitlistStampMs[GATE_WAITLIST_SIZE];
+static volatile uint8 Glob_u8WaitlistHead = 0;
+static volatile uint8 Glob_u8WaitlistTail = 0;
+
+/**
+ * @brief The admission of the head of the waiting list, sent by the main loop and confirmed by
+ * the entry notification of the entrance gate.
+ * 
+ */
+static volatile boolean Glob_boolAdmissionSent = FALSE;
+static volatile boolean Glob_boolAdmissionConfirmed = FALSE;
+static uint32 Glob_u32AdmissionStampMs;
+
+/**
+ * @brief Milliseconds counted from the cycle counter by the main loop, unlike the counter its range
+ * doesn't depend on the core clock.
+ * 
+ */
+static volatile uint32 Glob_u32NowMs = 0;
+static uint32 Glob_u32ClockStamp = 0;
+
+/**
+ * @brief TRUE from taking a request out of the queue until its result is sent, the request
+ * being served is ahead of the queued ones.
+ * 
+ */
+static volatile boolean Glob_boolServingRequest = FALSE;
+
+static uint8 Glob_u8AvailableSlots = 3;
+
+/**
+ * @brief Version of the allow-list and the last updates done to it.
+ * 
+ */
+static uint8 Glob_u8AuthListVersion = 1;
+static sCacheUpdate_t Glob_asCacheLog[GATE_CACHE_LOG_SIZE];
+static uint8 Glob_u8CacheLogNext = 0;
+/**
+  * @}
+  */
+
+
+/** @defgroup Private Functions
+  * @{
+  */
+
+/*The reply to a request is started from the data completion of its frame*/
+void ENTRANCE_GATE_ECU_SyncComplete_Callback(void);
+void EXIT_GATE_ECU_SyncComplete_Callback(void);
+
+/**
+ * @brief This function submits the sync transaction of the frame, the gate is expected to answer
+ * with its address.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param copy_u8TxByte : The byte to be sent to the gate.
+ * @param callback : Called when the sync byte is exchanged.
+ */
+static void GatesComm_SubmitSync(sGateLink_t* link, uint8 copy_u8TxByte, fptr_Callback callback)
+{
+    link->u8SyncTxByte = copy_u8TxByte;
+
+    link->sSyncTransaction.pu8TxBuffer = &link->u8SyncTxByte;
+    link->sSyncTransaction.pu8RxBuffer = &link->u8SyncRxByte;
+    link->sSyncTransaction.u16Length = 1;
+    link->sSyncTransaction.u8MaxRetries = SYNC_MAX_BUS_RETRIES;
+    link->sSyncTransaction.CS_Port = NULL;
+    link->sSyncTransaction.psNext = NULL;
+    link->sSyncTransaction.fptr_OnComplete = callback;
+
+    if(MCAL_SPI_SubmitTransaction(link->SPIx, &link->sSyncTransaction) != E_OK)
+    {
+        link->u8LinkState = GATE_LINK_IDLE;
+    }else{
+
+    }
+}
+
+/**
+ * @brief This function submits the data transaction of the frame once the gate is in sync.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param callback : Called when the data is exchanged.
+ */
+static void GatesComm_SubmitData(sGateLink_t* link, fptr_Callback callback)
+{
+    if(link->u8LinkState == GATE_LINK_RECEIVING_ID)
+    {
+        /*Clock the request out of the gate*/
+        link->sDataTransaction.pu8TxBuffer = NULL;
+        link->sDataTransaction.pu8RxBuffer = link->au8RequestFrame;
+        link->sDataTransaction.u16Length = GATE_REQUEST_HEADER_SIZE + AUTHORIZED_ID_SIZE;
+    }else if(link->u8LinkState == GATE_LINK_SENDING_CACHE_UPDATE){
+        link->sDataTransaction.pu8TxBuffer = link->au8CacheFrame;
+        link->sDataTransaction.pu8RxBuffer = NULL;
+        link->sDataTransaction.u16Length = GATE_CACHE_FRAME_SIZE;
+    }else{
+        link->sDataTransaction.pu8TxBuffer = link->au8ResultFrame;
+        link->sDataTransaction.pu8RxBuffer = NULL;
+        link->sDataTransaction.u16Length = GATE_RESULT_FRAME_SIZE;
+    }
+
+    link->sDataTransaction.u8MaxRetries = DATA_MAX_BUS_RETRIES;
+    link->sDataTransaction.CS_Port = NULL;
+    link->sDataTransaction.psNext = NULL;
+    link->sDataTransaction.fptr_OnComplete = callback;
+
+    if(MCAL_SPI_SubmitTransaction(link->SPIx, &link->sDataTransaction) != E_OK)
+    {
+        link->u8LinkState = GATE_LINK_IDLE;
+    }else{
+
+    }
+}
+
+/**
+ * @brief This function starts sending a result or a reply frame to the gate.
+ * 
+ * @param link : The link of the gate ECU, it must be idle.
+ * @param copy_u8Code : Must be a value of @ref AUTHENTICATION_RESULT or @ref GATE_REPLY.
+ * @param copy_u8Argument : The argument of a reply or the slots left for a result.
+ * @param copy_u8Detail : Built with GATE_RESULT_DETAIL for a result, 0 for a reply.
+ * @param syncCallback : The sync completion callback of the link.
+ */
+static void GatesComm_StartSendingResult(sGateLink_t* link, uint8 copy_u8Code, uint8 copy_u8Argument, 
+                                         uint8 copy_u8Detail, fptr_Callback syncCallback)
+{
+    link->u8LinkState = GATE_LINK_SENDING_RESULT;
+    link->u8FailedTransmissions = 0;
+    link->au8ResultFrame[GATE_RESULT_CODE_INDEX] = copy_u8Code;
+    link->au8ResultFrame[GATE_RESULT_ARGUMENT_INDEX] = copy_u8Argument;
+    link->au8ResultFrame[GATE_RESULT_DETAIL_INDEX] = copy_u8Detail;
+
+    /*Send the address of the gate to act as the start of the frame*/
+    GatesComm_SubmitSync(link, link->u8GateAddress, syncCallback);
+}
+
+/**
+ * @brief This function returns the number of slots left after a vehicle passed a gate.
+ * 
+ * @param copy_u8GateAddress : Address of the gate the vehicle passed.
+ * @param copy_u8Slots : Slots left before the vehicle passed.
+ * @return uint8 : Slots left after the vehicle passed, it stays within the garage slots.
+ */
+static uint8 GatesComm_SlotsAfterVehicle(uint8 copy_u8GateAddress, uint8 copy_u8Slots)
+{
+    if((copy_u8GateAddress == ENTRANCE_GATE_ECU_ADDRESS) && (copy_u8Slots > 0))
+    {
+        copy_u8Slots--;
+
+    }else if((copy_u8GateAddress != ENTRANCE_GATE_ECU_ADDRESS) && (copy_u8Slots < NUMBER_OF_GARAGE_SLOTS)){
+
+        copy_u8Slots++;
+    }else{
+
+    }
+
+    return copy_u8Slots;
+}
+
+/**
+ * @brief This function returns the number of slots left counting the vehicles the gates reported
+ * that aren't applied to the display yet.
+ * 
+ * @return uint8 : Slots left.
+ */
+static uint8 GatesComm_SlotsLeft(void)
+{
+    uint8 LOC_u8Slots = Glob_u8AvailableSlots;
+    uint8 LOC_u8Vehicle;
+
+    for(LOC_u8Vehicle = Glob_sEntranceGateLink.u8CountedVehicles; 
+        LOC_u8Vehicle != Glob_sEntranceGateLink.u8ReportedVehicles; LOC_u8Vehicle++)
+    {
+        LOC_u8Slots = GatesComm_SlotsAfterVehicle(ENTRANCE_GATE_ECU_ADDRESS, LOC_u8Slots);
+    }
+
+    for(LOC_u8Vehicle = Glob_sExitGateLink.u8CountedVehicles; 
+        LOC_u8Vehicle != Glob_sExitGateLink.u8ReportedVehicles; LOC_u8Vehicle++)
+    {
+        LOC_u8Slots = GatesComm_SlotsAfterVehicle(EXIT_GATE_ECU_ADDRESS, LOC_u8Slots);
+    }
+
+    return LOC_u8Slots;
+}
+
+/**
+ * @brief This function returns the number of drivers in the waiting list.
+ * 
+ * @return uint8 : Drivers waiting for a slot.
+ */
+static uint8 GatesComm_WaitlistCount(void)
+{
+    return (uint8)(Glob_u8WaitlistHead - Glob_u8WaitlistTail);
+}
+
+/**
+ * @brief This function returns the number of slots left for new entrance requests, the waiting
+ * drivers take the slots that free up first.
+ * 
+ * @return uint8 : Slots left that no waiting driver takes.
+ */
+static uint8 GatesComm_FreeSlots(void)
+{
+    uint8 LOC_u8Slots = GatesComm_SlotsLeft();
+    uint8 LOC_u8Waiting = GatesComm_WaitlistCount();
+
+    return (LOC_u8Slots > LOC_u8Waiting)? (uint8)(LOC_u8Slots - LOC_u8Waiting) : 0;
+}
+
+/**
+ * @brief This function returns the places the entrance gate can still give a new driver, a free slot
+ * or else the place in the waiting list.
+ * 
+ * @return uint8 : Places left, the garage is full for the gate at 0 when no slot is free and a driver
+ * already waits for the next one.
+ */
+static uint8 GatesComm_EntrancePlaces(void)
+{
+    uint8 LOC_u8FreeSlots = GatesComm_FreeSlots();
+
+    return (GatesComm_WaitlistCount() == 0)? (uint8)(LOC_u8FreeSlots + 1u) : LOC_u8FreeSlots;
+}
+
+/**
+ * @brief This function removes the waiting driver with its admission.
+ * 
+ * @note Called from the main loop, or from the entrance SPI ISR that also confirms the admission.
+ */
+static void GatesComm_WaitlistClear(void)
+{
+    uint32 LOC_u32PriMask;
+
+    LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+
+    Glob_u8WaitlistTail = Glob_u8WaitlistHead;
+    Glob_boolAdmissionSent = FALSE;
+    Glob_boolAdmissionConfirmed = FALSE;
+
+    MCAL_NVIC_ExitCritical(LOC_u32PriMask);
+}
+
+/**
+ * @brief This function makes a valid entrance driver wait in the list.
+ * 
+ * @param ptr_DriverID : The driver ID.
+ * @return uint8 : The place of the driver in the list, 1 is let in first.
+ * 
+ * @note It's only called while the entrance link is busy or claimed, the gate waits on the request
+ * being answered so a driver already in the list was given up by the gate.
+ */
+static uint8 GatesComm_WaitlistPush(const uint8* ptr_DriverID)
+{
+    GatesComm_WaitlistClear();
+
+    memcpy(Glob_au8Waitlist[Glob_u8WaitlistHead & GATE_WAITLIST_MASK], ptr_DriverID, AUTHORIZED_ID_SIZE);
+    Glob_au32WaitlistStampMs[Glob_u8WaitlistHead & GATE_WAITLIST_MASK] = Glob_u32NowMs;
+
+    /*Publish the entry after it's complete*/
+    Glob_u8WaitlistHead++;
+
+    return GatesComm_WaitlistCount();
+}
+
+/**
+ * @brief This function starts sending the authentication result to the gate with the slots left and
+ * the message the gate shows.
+ * 
+ * @param link : The link of the gate ECU, it must be idle.
+ * @param copy_u8Result : Must be a value of @ref AUTHENTICATION_RESULT.
+ * @param copy_u8Reason : Must be a value of @ref GATE_RESULT_DETAIL reasons.
+ * @param copy_u8Slots : Slots left after the vehicle passed.
+ * @param syncCallback : The sync completion callback of the link.
+ */
+static void GatesComm_StartSendingVerdict(sGateLink_t* link, uint8 copy_u8Result, uint8 copy_u8Reason, 
+                                          uint8 copy_u8Slots, fptr_Callback syncCallback)
+{
+    uint8 LOC_u8Message;
+
+    if(copy_u8Result == AUTHENTICATION_RESULT_PASS)
+    {
+        LOC_u8Message = (link->u8GateAddress == ENTRANCE_GATE_ECU_ADDRESS)? GATE_RESULT_MSG_WELCOME : GATE_RESULT_MSG_GOODBYE;
+
+    }else if(copy_u8Reason == GATE_RESULT_REASON_RATE_LIMITED){
+
+        LOC_u8Message = GATE_RESULT_MSG_CONTACT_ADMIN;
+    }else{
+        LOC_u8Message = GATE_RESULT_MSG_NONE;
+    }
+
+    GatesComm_StartSendingResult(link, copy_u8Result, copy_u8Slots, 
+                                 GATE_RESULT_DETAIL(copy_u8Reason, LOC_u8Message), syncCallback);
+}
+
+/**
+ * @brief This function handles the end of the sync transaction, it moves to the data transaction
+ * if the gate answered with its address or retries the sync otherwise.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param syncCallback : The sync completion callback of the link.
+ * @param dataCallback : The data completion callback of the link.
+ */
+static void GatesComm_SyncComplete(sGateLink_t* link, fptr_Callback syncCallback, fptr_Callback dataCallback)
+{
+    if((link->sSyncTransaction.eStatus == SPI_TRANSACTION_DONE) && (link->u8SyncRxByte == link->u8GateAddress))
+    {
+        GatesComm_SubmitData(link, dataCallback);
+    }else{
+        link->u8FailedTransmissions++;
+
+        /*Put a limit on the number of failed tries to avoid getting stuck*/
+        if(link->u8FailedTransmissions < MAX_FAILED_TRANSMISSIONS)
+        {
+            GatesComm_SubmitSync(link, 
+                (link->u8LinkState == GATE_LINK_RECEIVING_ID)? GATE_FRAME_DUMMY_BYTE : link->u8SyncTxByte, syncCallback);
+        }else{
+            /*Stop pushing to a gate that doesn't answer until it sends a request again*/
+            if(link->u8LinkState == GATE_LINK_SENDING_CACHE_UPDATE)
+            {
+                link->boolCachePushEnabled = FALSE;
+            }else{
+
+            }
+
+            link->u8LinkState = GATE_LINK_IDLE;
+        }
+    }
+}
+
+/**
+ * @brief This function gives back the failures bucket tokens earned since its last refill.
+ * 
+ * @param link : The link of the gate ECU.
+ * @return boolean : TRUE if the bucket has a token left.
+ */
+static boolean GatesComm_RefillFailBucket(sGateLink_t* link)
+{
+    uint32 LOC_u32Now = MCAL_DWT_GetCycles();
+    uint32 LOC_u32Period = GATE_FAIL_REFILL_MS * MCAL_DWT_GetCyclesPerMs();
+    uint32 LOC_u32Refills = (LOC_u32Now - link->u32FailRefillStamp) / LOC_u32Period;
+
+    if(LOC_u32Refills >= link->u8FailTokensUsed)
+    {
+        link->u8FailTokensUsed = 0;
+        link->u32FailRefillStamp = LOC_u32Now;
+    }else{
+        link->u8FailTokensUsed -= (uint8)LOC_u32Refills;
+        link->u32FailRefillStamp += LOC_u32Refills * LOC_u32Period;
+    }
+
+    return (link->u8FailTokensUsed < GATE_FAIL_BUCKET_SIZE)? TRUE : FALSE;
+}
+
+/**
+ * @brief This function takes a token from the failures bucket of the gate after a failed authentication.
+ * 
+ * @param link : The link of the gate ECU.
+ */
+static void GatesComm_TakeFailToken(sGateLink_t* link)
+{
+    /*A full bucket starts earning tokens back from now*/
+    if(link->u8FailTokensUsed == 0)
+    {
+        link->u32FailRefillStamp = MCAL_DWT_GetCycles();
+    }else{
+
+    }
+
+    if(link->u8FailTokensUsed < GATE_FAIL_BUCKET_SIZE)
+    {
+        link->u8FailTokensUsed++;
+    }else{
+
+    }
+}
+
+/**
+ * @brief This function authenticates the request while its frame is completed, the verdict is sent
+ * right after the frame instead of going through the queue.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param syncCallback : The sync completion callback of the link.
+ * @return boolean : TRUE if the verdict was sent, FALSE if the request must be queued.
+ * 
+ * @note A gate with queued requests keeps its order through the queue, and the list can't be
+ * checked while the admin is changing it.
+ */
+static boolean GatesComm_FastAuthenticate(sGateLink_t* link, fptr_Callback syncCallback)
+{
+    boolean LOC_boolAnswered = FALSE;
+    uint8 LOC_u8Lookup;
+
+    if(link->u8PendingRequests == 0)
+    {
+        LOC_u8Lookup = AI_GC_LookupID(link->sRequest.szDriverID);
+
+        if((LOC_u8Lookup == AI_LOOKUP_FOUND) && 
+           (link->u8GateAddress == ENTRANCE_GATE_ECU_ADDRESS) && (GatesComm_FreeSlots() == 0))
+        {
+            /*The driver replaces one the gate gave up on*/
+            GatesComm_StartSendingResult(link, GATE_REPLY_WAITLISTED, 
+                GatesComm_WaitlistPush(link->sRequest.szDriverID), 0, syncCallback);
+            LOC_boolAnswered = TRUE;
+
+        }else if(LOC_u8Lookup == AI_LOOKUP_FOUND){
+
+            /*The slots are updated from the main loop*/
+            link->u8ReportedVehicles++;
+
+            GatesComm_StartSendingVerdict(link, AUTHENTICATION_RESULT_PASS, GATE_RESULT_REASON_NONE, 
+                                          GatesComm_SlotsLeft(), syncCallback);
+            LOC_boolAnswered = TRUE;
+
+        }else if(LOC_u8Lookup == AI_LOOKUP_NOT_FOUND){
+
+            GatesComm_TakeFailToken(link);
+
+            GatesComm_StartSendingVerdict(link, AUTHENTICATION_RESULT_FAIL, GATE_RESULT_REASON_NOT_AUTHORIZED, 
+                                          GatesComm_SlotsLeft(), syncCallback);
+            LOC_boolAnswered = TRUE;
+        }else{
+
+        }
+    }else{
+
+    }
+
+    return LOC_boolAnswered;
+}
+
+/**
+ * @brief This function handles a request received from the gate.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param syncCallback : The sync completion callback of the link.
+ * 
+ * @note An authentication request is answered right away so the gate never waits for a request
+ * that was dropped, the other requests are handled as soon as the frame is taken.
+ * A repeat of the last pending request of the gate isn't queued again, the gate takes the result
+ * of the pending one. A gate out of failure tokens is refused without queueing the request.
+ * Otherwise the ID is checked right away and only queued when that can't be done.
+ */
+static void GatesComm_RequestReceived(sGateLink_t* link, fptr_Callback syncCallback)
+{
+    uint8 LOC_u8RequestType = link->au8RequestFrame[GATE_REQUEST_TYPE_INDEX];
+
+    /*Every request reports the version of the gate cache, a cache filled before this ECU 
+      started is reloaded as the list may have changed since*/
+    link->u8CacheVersion = (link->boolCacheLoaded == TRUE)? 
+                           link->au8RequestFrame[GATE_REQUEST_VERSION_INDEX] : GATE_CACHE_VERSION_UNSYNCED;
+    link->boolCachePushEnabled = TRUE;
+
+    /*A gate with an unsynced cache has restarted and lost the occupancy too*/
+    if(link->au8RequestFrame[GATE_REQUEST_VERSION_INDEX] == GATE_CACHE_VERSION_UNSYNCED)
+    {
+        link->u8PushedOccupancy = GATE_OCCUPANCY_UNKNOWN;
+    }else{
+
+    }
+
+    if(LOC_u8RequestType == GATE_REQUEST_CACHE_SYNC)
+    {
+        link->boolCacheSyncRequested = TRUE;
+
+    }else if((LOC_u8RequestType == GATE_REQUEST_ENTRY_NOTIFY) || (LOC_u8RequestType == GATE_REQUEST_OFFLINE_ENTRY)){
+
+        /*Only count the vehicle, a journal replayed in bulk would overflow the requests queue*/
+        link->u8ReportedVehicles++;
+
+        /*The waiting driver took its admission, the vehicle is counted now*/
+        if((link->u8GateAddress == ENTRANCE_GATE_ECU_ADDRESS) && (Glob_boolAdmissionSent == TRUE) &&
+           (memcmp(Glob_au8Waitlist[Glob_u8WaitlistTail & GATE_WAITLIST_MASK], 
+                   &link->au8RequestFrame[GATE_REQUEST_HEADER_SIZE], AUTHORIZED_ID_SIZE) == 0))
+        {
+            Glob_boolAdmissionConfirmed = TRUE;
+        }else{
+
+        }
+
+    }else if(LOC_u8RequestType == GATE_REQUEST_AUTHENTICATE){
+
+        link->sRequest.GateAddress = link->u8GateAddress;
+        memcpy(link->sRequest.szDriverID, &link->au8RequestFrame[GATE_REQUEST_HEADER_SIZE], AUTHORIZED_ID_SIZE);
+        link->sRequest.szDriverID[AUTHORIZED_ID_SIZE] = '\0';
+
+        /*The gate has one request at a time, a driver still waiting was given up by the gate
+          and doesn't take the slot of the new one*/
+        if(link->u8GateAddress == ENTRANCE_GATE_ECU_ADDRESS)
+        {
+            GatesComm_WaitlistClear();
+        }else{
+
+        }
+
+        if(GatesComm_RefillFailBucket(link) == FALSE)
+        {
+
+            GatesComm_StartSendingVerdict(link, AUTHENTICATION_RESULT_FAIL, GATE_RESULT_REASON_RATE_LIMITED, 
+                                          GatesComm_SlotsLeft(), syncCallback);
+
+        }else if((link->u8PendingRequests > 0) && 
+           (memcmp(link->au8LastRequestID, link->sRequest.szDriverID, AUTHORIZED_ID_SIZE) == 0))
+        {
+            /*The position of the pending request is at most the last one*/
+            GatesComm_StartSendingResult(link, GATE_REPLY_ACCEPTED, 
+                (uint8)(Glob_sQueueBuffer.size + ((Glob_boolServingRequest == TRUE)? 1u : 0u)), 0, syncCallback);
+
+        }else if(GatesComm_FastAuthenticate(link, syncCallback) == TRUE){
+
+            /*The verdict is on its way to the gate*/
+        }else if(FIFO_enqueue(&Glob_sQueueBuffer, link->sRequest) == FIFO_no_error){
+
+            link->u8PendingRequests++;
+            memcpy(link->au8LastRequestID, link->sRequest.szDriverID, AUTHORIZED_ID_SIZE);
+
+            /*Position 1 is served next*/
+            GatesComm_StartSendingResult(link, GATE_REPLY_ACCEPTED, 
+                (uint8)(Glob_sQueueBuffer.size + ((Glob_boolServingRequest == TRUE)? 1u : 0u)), 0, syncCallback);
+        }else{
+            GatesComm_StartSendingResult(link, GATE_REPLY_BUSY, GATE_REPLY_BUSY_RETRY_AFTER, 0, syncCallback);
+        }
+    }else{
+
+    }
+}
+
 /**
-  * @}
-  */
+ * @brief This function updates what is known about the gate cache after a cache update frame.
+ * 
+ * @param link : The link of the gate ECU.
+ */
+static void GatesComm_CacheUpdateSent(sGateLink_t* link)
+{
+    if(link->sDataTransaction.eStatus == SPI_TRANSACTION_DONE)
+    {
+        switch(link->au8CacheFrame[GATE_CACHE_FRAME_OP_INDEX])
+        {
+            case GATE_CACHE_OP_SYNC:
+                link->boolCacheSyncRequested = FALSE;
+                break;
+
+            case GATE_CACHE_OP_OCCUPANCY:
+                link->u8PushedOccupancy = (link->au8CacheFrame[GATE_CACHE_FRAME_ID_INDEX] == 0)? 
+                                          GATE_OCCUPANCY_FULL : GATE_OCCUPANCY_NOT_FULL;
+                break;
+
+            case GATE_CACHE_OP_LOAD:
+                link->u8SnapshotIndex++;
+                break;
+
+            case GATE_CACHE_OP_CLEAR:
+                link->boolCacheLoaded = TRUE;
+                link->u8SnapshotIndex = 0;
+                link->u8CacheVersion = link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX];
+                break;
+
+            default: /*GATE_CACHE_OP_ADD, GATE_CACHE_OP_REMOVE*/
+                link->u8CacheVersion = link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX];
+                break;
+        }
+    }else{
+        /*The gate may or may not have applied the update, wait for it to report its version*/
+        link->boolCachePushEnabled = FALSE;
+    }
+}
+
+/**
+ * @brief This function handles the end of the data transaction, if it was aborted after a bus error
+ * the frame is dropped and the link goes back to idle to resync on the next frame.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param syncCallback : The sync completion callback of the link.
+ */
+static void GatesComm_DataComplete(sGateLink_t* link, fptr_Callback syncCallback)
+{
+    uint8 LOC_u8LinkState = link->u8LinkState;
+
+    /*The link is free, the request handling may start the reply on it*/
+    link->u8LinkState = GATE_LINK_IDLE;
+
+    /*If we received all the required information handle the request*/
+    if((LOC_u8LinkState == GATE_LINK_RECEIVING_ID) && (link->sDataTransaction.eStatus == SPI_TRANSACTION_DONE))
+    {
+        GatesComm_RequestReceived(link, syncCallback);
+
+    }else if(LOC_u8LinkState == GATE_LINK_SENDING_CACHE_UPDATE){
+
+        GatesComm_CacheUpdateSent(link);
+    }else{
+
+    }
+}
+
+/**
+ * @brief This function starts receiving a request from the gate.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param syncCallback : The sync completion callback of the link.
+ */
+static void GatesComm_StartReceivingRequest(sGateLink_t* link, fptr_Callback syncCallback)
+{
+    link->u8LinkState = GATE_LINK_RECEIVING_ID;
+    link->u8FailedTransmissions = 0;
+
+    GatesComm_SubmitSync(link, GATE_FRAME_START_BYTE, syncCallback);
+}
 /**
   * @}
   */
 
 
-/** @defgroup Local Variables
+/** @defgroup ISR_CALLBACK_DEFINITIONS
   * @{
   */
+void ENTRANCE_GATE_ECU_DataComplete_Callback(void)
+{
+    GatesComm_DataComplete(&Glob_sEntranceGateLink, ENTRANCE_GATE_ECU_SyncComplete_Callback);
+}
+
+void ENTRANCE_GATE_ECU_SyncComplete_Callback(void)
+{
+    GatesComm_SyncComplete(&Glob_sEntranceGateLink, ENTRANCE_GATE_ECU_SyncComplete_Callback, ENTRANCE_GATE_ECU_DataComplete_Callback);
+}
+
+void EXIT_GATE_ECU_DataComplete_Callback(void)
+{
+    GatesComm_DataComplete(&Glob_sExitGateLink, EXIT_GATE_ECU_SyncComplete_Callback);
+}
+
+void EXIT_GATE_ECU_SyncComplete_Callback(void)
+{
+    GatesComm_SyncComplete(&Glob_sExitGateLink, EXIT_GATE_ECU_SyncComplete_Callback, EXIT_GATE_ECU_DataComplete_Callback);
+}
 
 /**
- * @brief Queue to hold all the requests from the 2 gates to be processed
- *  by following the First In First Out schema.
+ * @brief The callback function for the external interrupt line connected to the 
+ * entrance gate ECU. 
  * 
  */
-static sFIFO_Buf_t Glob_sQueueBuffer;
-static sGateRequestInfo_t Glob_szGatesRequests[MAX_NUMBER_OF_REQUESTS];
+void EXTI_Line4_ISR_Callback(void)
+{
+    if(Glob_sEntranceGateLink.u8LinkState == GATE_LINK_IDLE)
+    {
+        GatesComm_StartReceivingRequest(&Glob_sEntranceGateLink, ENTRANCE_GATE_ECU_SyncComplete_Callback);
+
+    }else if(Glob_sEntranceGateLink.u8LinkState != GATE_LINK_RECEIVING_ID){
+
+        /*Take the request once the link is free*/
+        Glob_sEntranceGateLink.boolAttentionPending = TRUE;
+    }else{
 
-static sGateRequestInfo_t Glob_sEntranceGateRequest;
-static sGateRequestInfo_t Glob_sExitGateRequest;
+    }
+}
 
 /**
- * @brief Holds the address of the gate which has a request currenlty being processed.
+ * @brief The callback function for the external interrupt line connected to the 
+ * exit gate ECU. 
  * 
  */
-static uint8 Glob_u8ServedRequestGateAddress;
+void EXTI_Line12_ISR_Callback(void)
+{
+    if(Glob_sExitGateLink.u8LinkState == GATE_LINK_IDLE)
+    {
+        GatesComm_StartReceivingRequest(&Glob_sExitGateLink, EXIT_GATE_ECU_SyncComplete_Callback);
 
-static uint8 Glob_u8AvailableSlots = 3;
+    }else if(Glob_sExitGateLink.u8LinkState != GATE_LINK_RECEIVING_ID){
+
+        /*Take the request once the link is free*/
+        Glob_sExitGateLink.boolAttentionPending = TRUE;
+    }else{
+
+    }
+}
 /**
   * @}
   */
 
 
-
-/** @defgroup ISR_CALLBACK_DEFINITIONS
+/** @defgroup Private Functions
   * @{
   */
-void ENTRANCE_GATE_ECU_SPI_TXEmpty_ISR_Callback(void)
+
+/**
+ * @brief This function starts sending the authentication result to the gate being served.
+ * 
+ * @param copy_u8Result : Must be a value of @ref AUTHENTICATION_RESULT or GATE_REPLY_WAITLISTED to
+ * add the driver to the waiting list.
+ * @param copy_u8Reason : Must be a value of @ref GATE_RESULT_DETAIL reasons.
+ * @return eStatus_t : E_OK if the frame was started, E_NOK if the gate link is busy receiving a frame.
+ */
+static eStatus_t GatesComm_SendAuthenticationResult(uint8 copy_u8Result, uint8 copy_u8Reason)
 {
-    static uint8 LOC_u8TransmitCounter = 0;
-    static uint8 LOC_u8FailedTrasnsmissionCounter = 0;
-    
-    if(LOC_u8TransmitCounter == 0)
-    {
-        MCAL_SPI_ReceiveData(ENTRANCE_GATE_ECU_SPI, (uint16 *)&Glob_sEntranceGateRequest.GateAddress, PollingDisable);
-        
-        /*Wait the acknowledge byte from the slave*/
-        if(Glob_sEntranceGateRequest.GateAddress != ENTRANCE_GATE_ECU_ADDRESS)
-        {
-            LOC_u8FailedTrasnsmissionCounter++;
-            LOC_u8TransmitCounter--;
-        }
+    eStatus_t LOC_eStatus = E_NOK;
+    sGateLink_t* LOC_psLink;
+    fptr_Callback LOC_fptrSyncCallback;
 
+    if(Glob_u8ServedRequestGateAddress == ENTRANCE_GATE_ECU_ADDRESS)
+    {
+        LOC_psLink = &Glob_sEntranceGateLink;
+        LOC_fptrSyncCallback = ENTRANCE_GATE_ECU_SyncComplete_Callback;
     }else{
-        MCAL_SPI_ReceiveData(ENTRANCE_GATE_ECU_SPI, 
-                            (uint16 *)&Glob_sEntranceGateRequest.szDriverID[LOC_u8TransmitCounter - 1], PollingDisable);
+        LOC_psLink = &Glob_sExitGateLink;
+        LOC_fptrSyncCallback = EXIT_GATE_ECU_SyncComplete_Callback;
     }
 
-    LOC_u8TransmitCounter++;
+    /*Keep the gate attention interrupt away while claiming the link*/
+    MCAL_NVIC_DisableIRQ(LOC_psLink->u8EXTI_IVT_index);
 
-    /*If we received all the required information add it to the queue*/
-    if(LOC_u8TransmitCounter == 4 || LOC_u8FailedTrasnsmissionCounter == 10)
+    if(LOC_psLink->u8LinkState == GATE_LINK_IDLE)
     {
-        if(LOC_u8FailedTrasnsmissionCounter != 10)
+        if(copy_u8Result == GATE_REPLY_WAITLISTED)
         {
-            Glob_sEntranceGateRequest.szDriverID[LOC_u8TransmitCounter - 1] = '\0';
-            
-            FIFO_enqueue(&Glob_sQueueBuffer, Glob_sEntranceGateRequest);
+            GatesComm_StartSendingResult(LOC_psLink, GATE_REPLY_WAITLISTED, 
+                GatesComm_WaitlistPush(Glob_au8ServedRequestID), 0, LOC_fptrSyncCallback);
+        }else{
+            /*A passing vehicle is counted like a reported one, the SPI ISRs see the slot taken
+              right away and the main loop applies it to the available slots*/
+            if(copy_u8Result == AUTHENTICATION_RESULT_PASS)
+            {
+                LOC_psLink->u8ReportedVehicles++;
+            }else{
+
+            }
+
+            GatesComm_StartSendingVerdict(LOC_psLink, copy_u8Result, copy_u8Reason, GatesComm_SlotsLeft(), 
+                                          LOC_fptrSyncCallback);
+        }
+
+        /*The EXTI is disabled and the link is busy, no request of the gate can be received meanwhile*/
+        LOC_psLink->u8PendingRequests--;
+
+        if(copy_u8Reason == GATE_RESULT_REASON_NOT_AUTHORIZED)
+        {
+            GatesComm_TakeFailToken(LOC_psLink);
+        }else{
+
         }
 
-            LOC_u8TransmitCounter = 0;
+        Glob_boolServingRequest = FALSE;
+
+        LOC_eStatus = E_OK;
     }else{
-        /*Dummy data to receive the information from the slave*/
-        uint16 LOC_pu16TxBuffer = 0x0000u;
 
-        MCAL_SPI_SendData(ENTRANCE_GATE_ECU_SPI, &LOC_pu16TxBuffer, PollingDisable);    
     }
+
+    MCAL_NVIC_EnableIRQ(LOC_psLink->u8EXTI_IVT_index);
+
+    return LOC_eStatus;
 }
 
-void EXIT_GATE_ECU_SPI_TXEmpty_ISR_Callback(void)
+/**
+ * @brief This function finds the update that moves the allow-list to the given version.
+ * 
+ * @param copy_u8Version : Version of the allow-list after the update.
+ * @return const sCacheUpdate_t* : The update or NULL if it's not in the log anymore.
+ */
+static const sCacheUpdate_t* GatesComm_FindCacheUpdate(uint8 copy_u8Version)
 {
-    static uint8 LOC_u8TransmitCounter = 0;
-    static uint8 LOC_u8FailedTrasnsmissionCounter = 0;
-    
-    if(LOC_u8TransmitCounter == 0)
+    const sCacheUpdate_t* LOC_psUpdate = NULL;
+    uint8 LOC_u8Index;
+
+    for(LOC_u8Index = 0; LOC_u8Index < GATE_CACHE_LOG_SIZE; LOC_u8Index++)
     {
-        MCAL_SPI_ReceiveData(EXIT_GATE_ECU_SPI, (uint16 *)&Glob_sExitGateRequest.GateAddress, PollingDisable);
-        
-        /*Wait the acknowledge byte from the slave*/
-        if(Glob_sExitGateRequest.GateAddress != EXIT_GATE_ECU_ADDRESS)
+        if(Glob_asCacheLog[LOC_u8Index].u8Version == copy_u8Version)
         {
-            LOC_u8FailedTrasnsmissionCounter++;
-            LOC_u8TransmitCounter--;
-        }
+            LOC_psUpdate = &Glob_asCacheLog[LOC_u8Index];
+        }else{
 
-    }else{
-        MCAL_SPI_ReceiveData(EXIT_GATE_ECU_SPI, 
-                            (uint16 *)&Glob_sExitGateRequest.szDriverID[LOC_u8TransmitCounter - 1], PollingDisable);
+        }
     }
 
-    LOC_u8TransmitCounter++;
+    return LOC_psUpdate;
+}
+
+/**
+ * @brief This function records an update of the allow-list to be pushed to the gates.
+ * 
+ * @param copy_u8Operation : Must be GATE_CACHE_OP_ADD or GATE_CACHE_OP_REMOVE.
+ * @param ptr_DriverID : The ID added or removed.
+ */
+static void GatesComm_LogCacheUpdate(uint8 copy_u8Operation, const uint8* ptr_DriverID)
+{
+    sCacheUpdate_t* LOC_psUpdate = &Glob_asCacheLog[Glob_u8CacheLogNext];
+
+    Glob_u8AuthListVersion = GATE_CACHE_NEXT_VERSION(Glob_u8AuthListVersion);
+
+    LOC_psUpdate->u8Operation = copy_u8Operation;
+    LOC_psUpdate->u8Version = Glob_u8AuthListVersion;
+    memcpy(LOC_psUpdate->au8DriverID, ptr_DriverID, AUTHORIZED_ID_SIZE);
+
+    Glob_u8CacheLogNext = (Glob_u8CacheLogNext + 1) % GATE_CACHE_LOG_SIZE;
+}
+
+/**
+ * @brief This function starts the next frame the gate link owes the gate when it's free, a request
+ * the gate asked for while the link was busy comes first then the cache updates.
+ * 
+ * A gate behind the allow-list gets the missing updates in order from the log, a gate too far behind
+ * is cleared and loaded with the current list, an up to date gate that asked for it gets a sync.
+ * 
+ * @param link : The link of the gate ECU.
+ * @param syncCallback : The sync completion callback of the link.
+ */
+static void GatesComm_ServiceLink(sGateLink_t* link, fptr_Callback syncCallback)
+{
+    const sCacheUpdate_t* LOC_psUpdate;
+    boolean LOC_boolSendUpdate = FALSE;
+    uint8 LOC_u8Places = GatesComm_EntrancePlaces();
+    uint8 LOC_u8Occupancy = (LOC_u8Places == 0)? GATE_OCCUPANCY_FULL : GATE_OCCUPANCY_NOT_FULL;
+
+    /*Keep the gate attention interrupt away while claiming the link*/
+    MCAL_NVIC_DisableIRQ(link->u8EXTI_IVT_index);
 
-    /*If we received all the required information add it to the queue*/
-    if(LOC_u8TransmitCounter == 4 || LOC_u8FailedTrasnsmissionCounter == 10)
+    if(link->u8LinkState != GATE_LINK_IDLE)
     {
-        if(LOC_u8FailedTrasnsmissionCounter != 10)
+
+    }else if(link->boolAttentionPending == TRUE){
+
+        link->boolAttentionPending = FALSE;
+
+        GatesComm_StartReceivingRequest(link, syncCallback);
+
+    }else if(link->boolCachePushEnabled == FALSE){
+
+    }else if((link->u8GateAddress == ENTRANCE_GATE_ECU_ADDRESS) && (link->u8PushedOccupancy != LOC_u8Occupancy)){
+
+        /*The places left is the occupancy, the version and the rest of the ID are unused*/
+        link->au8CacheFrame[GATE_CACHE_FRAME_OP_INDEX] = GATE_CACHE_OP_OCCUPANCY;
+        link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX] = GATE_CACHE_VERSION_UNSYNCED;
+        memset(&link->au8CacheFrame[GATE_CACHE_FRAME_ID_INDEX], 0, AUTHORIZED_ID_SIZE);
+        link->au8CacheFrame[GATE_CACHE_FRAME_ID_INDEX] = LOC_u8Places;
+
+        LOC_boolSendUpdate = TRUE;
+
+    }else if(link->u8CacheVersion != Glob_u8AuthListVersion){
+
+        LOC_psUpdate = GatesComm_FindCacheUpdate(GATE_CACHE_NEXT_VERSION(link->u8CacheVersion));
+
+        if((LOC_psUpdate != NULL) && (link->u8CacheVersion != GATE_CACHE_VERSION_UNSYNCED))
+        {
+            link->au8CacheFrame[GATE_CACHE_FRAME_OP_INDEX] = LOC_psUpdate->u8Operation;
+            link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX] = LOC_psUpdate->u8Version;
+            memcpy(&link->au8CacheFrame[GATE_CACHE_FRAME_ID_INDEX], LOC_psUpdate->au8DriverID, AUTHORIZED_ID_SIZE);
+        }else{
+            link->au8CacheFrame[GATE_CACHE_FRAME_OP_INDEX] = GATE_CACHE_OP_CLEAR;
+            link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX] = Glob_u8AuthListVersion;
+        }
+
+        LOC_boolSendUpdate = TRUE;
+
+    }else if(link->u8SnapshotIndex != GATE_CACHE_NO_SNAPSHOT){
+
+        /*The list is read as it is now, an ID removed after the clear is never loaded*/
+        if(AI_GC_GetAuthorizedID(link->u8SnapshotIndex, &link->au8CacheFrame[GATE_CACHE_FRAME_ID_INDEX]) == E_OK)
         {
-            Glob_sExitGateRequest.szDriverID[LOC_u8TransmitCounter - 1] = '\0';
-            
-            FIFO_enqueue(&Glob_sQueueBuffer, Glob_sExitGateRequest);
+            link->au8CacheFrame[GATE_CACHE_FRAME_OP_INDEX] = GATE_CACHE_OP_LOAD;
+            link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX] = link->u8CacheVersion;
+
+            LOC_boolSendUpdate = TRUE;
+        }else{
+            link->u8SnapshotIndex = GATE_CACHE_NO_SNAPSHOT;
         }
 
-            LOC_u8TransmitCounter = 0;
+    }else if(link->boolCacheSyncRequested == TRUE){
+
+        link->au8CacheFrame[GATE_CACHE_FRAME_OP_INDEX] = GATE_CACHE_OP_SYNC;
+        link->au8CacheFrame[GATE_CACHE_FRAME_VERSION_INDEX] = link->u8CacheVersion;
+
+        LOC_boolSendUpdate = TRUE;
+    }else{
+
+    }
+
+    if(LOC_boolSendUpdate == TRUE)
+    {
+        link->u8LinkState = GATE_LINK_SENDING_CACHE_UPDATE;
+        link->u8FailedTransmissions = 0;
+
+        GatesComm_SubmitSync(link, GATE_FRAME_CACHE_START_BYTE, syncCallback);
     }else{
-        /*Dummy data to receive the information from the slave*/
-        uint16 LOC_pu16TxBuffer = 0x0000u;
 
-        MCAL_SPI_SendData(EXIT_GATE_ECU_SPI, &LOC_pu16TxBuffer, PollingDisable);    
     }
+
+    MCAL_NVIC_EnableIRQ(link->u8EXTI_IVT_index);
 }
 
 /**
- * @brief The callback function for the external interrupt line connected to the 
- * entrance gate ECU. 
+ * @brief This function applies the vehicles the gate reported to the available slots and the display.
  * 
+ * @param link : The link of the gate ECU.
+ * 
+ * @note The entries are refused while the garage is full, only a vehicle the gate let in on its own
+ * before it knew can find the slots at 0, and an exit from an empty garage leaves them at the maximum.
  */
-void EXTI_Line4_ISR_Callback(void)
+static void GatesComm_CountReportedVehicles(sGateLink_t* link)
 {
-    uint16 LOC_pu16TxBuffer = 0xFFFFu;
+    uint32 LOC_u32PriMask;
+    uint8 LOC_u8Slots;
+
+    while(link->u8CountedVehicles != link->u8ReportedVehicles)
+    {
+        /*The SPI ISRs add the vehicles not counted yet to the available slots, both change together*/
+        LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+
+        LOC_u8Slots = GatesComm_SlotsAfterVehicle(link->u8GateAddress, Glob_u8AvailableSlots);
+        Glob_u8AvailableSlots = LOC_u8Slots;
+        link->u8CountedVehicles++;
+
+        MCAL_NVIC_ExitCritical(LOC_u32PriMask);
 
-    MCAL_SPI_SendData(ENTRANCE_GATE_ECU_SPI, &LOC_pu16TxBuffer, PollingDisable);
+        HAL_SevenSeg_DisplayNumber(LOC_u8Slots);
+    }
 }
 
 /**
- * @brief The callback function for the external interrupt line connected to the 
- * exit gate ECU. 
+ * @brief This function counts the milliseconds elapsed on the cycle counter since its last call.
  * 
+ * @note It must be called before the cycle counter wraps, see MCAL_DWT_GetCycles.
  */
-void EXTI_Line12_ISR_Callback(void)
+static void GatesComm_UpdateClock(void)
 {
-    uint16 LOC_pu16TxBuffer = 0xFFFFu;
+    uint32 LOC_u32CyclesPerMs = MCAL_DWT_GetCyclesPerMs();
+    uint32 LOC_u32ElapsedMs = (MCAL_DWT_GetCycles() - Glob_u32ClockStamp) / LOC_u32CyclesPerMs;
 
-    MCAL_SPI_SendData(EXIT_GATE_ECU_SPI, &LOC_pu16TxBuffer, PollingDisable);
+    /*Keep the cycles of the started millisecond for the next call*/
+    Glob_u32ClockStamp += LOC_u32ElapsedMs * LOC_u32CyclesPerMs;
+    Glob_u32NowMs += LOC_u32ElapsedMs;
 }
+
 /**
-  * @}
-  */
+ * @brief This function sends the first waiting driver its admission once a slot is free, the gate is 
+ * still waiting for it so no lookup or tap is needed.
+ * 
+ * @note The slot stays taken by the waiting list until the gate notifies the entry, the admission is
+ * sent again until then. A driver the gate gave up on leaves the list before the gate takes another one.
+ */
+static void GatesComm_AdmitWaitingDriver(void)
+{
+    sGateLink_t* LOC_psLink = &Glob_sEntranceGateLink;
+    uint32 LOC_u32PriMask;
 
+    /*The entrance SPI ISR may replace the driver, check and remove the same one*/
+    LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+
+    if((Glob_boolAdmissionConfirmed == TRUE) || ((GatesComm_WaitlistCount() > 0) && 
+       ((Glob_u32NowMs - Glob_au32WaitlistStampMs[Glob_u8WaitlistTail & GATE_WAITLIST_MASK]) >= GATE_WAITLIST_TIMEOUT_MS)))
+    {
+        GatesComm_WaitlistClear();
+    }else{
+
+    }
+
+    MCAL_NVIC_ExitCritical(LOC_u32PriMask);
+
+    if((GatesComm_WaitlistCount() > 0) && (GatesComm_SlotsLeft() > 0) && 
+       ((Glob_boolAdmissionSent == FALSE) || ((Glob_u32NowMs - Glob_u32AdmissionStampMs) >= GATE_ADMISSION_RETRY_MS)))
+    {
+        /*Keep the gate attention interrupt away while claiming the link*/
+        MCAL_NVIC_DisableIRQ(LOC_psLink->u8EXTI_IVT_index);
+
+        if(LOC_psLink->u8LinkState == GATE_LINK_IDLE)
+        {
+            Glob_boolAdmissionSent = TRUE;
+            Glob_u32AdmissionStampMs = Glob_u32NowMs;
+
+            GatesComm_StartSendingResult(LOC_psLink, GATE_REPLY_ADMITTED, 
+                GatesComm_SlotsAfterVehicle(ENTRANCE_GATE_ECU_ADDRESS, GatesComm_SlotsLeft()), 
+                GATE_RESULT_DETAIL(GATE_RESULT_REASON_NONE, GATE_RESULT_MSG_WELCOME), ENTRANCE_GATE_ECU_SyncComplete_Callback);
+        }else{
+
+        }
+
+        MCAL_NVIC_EnableIRQ(LOC_psLink->u8EXTI_IVT_index);
+    }else{
+
+    }
+}
 
-/** @defgroup Private Functions
-  * @{
-  */
 void SPI_Init(void)
 {
     SPI_Config_t config;
@@ -213,19 +1285,18 @@ void SPI_Init(void)
 	  config.SPI_BR_Prescaler = SPI_BAUD_RATE_PRESCALER_8;
 
 	  MCAL_SPI_Init(ENTRANCE_GATE_ECU_SPI, &config);
-    
-    MCAL_SPI_Interrupt_EN(ENTRANCE_GATE_ECU_SPI, SPI_IRQ_TXEIE, ENTRANCE_GATE_ECU_SPI_TXEmpty_ISR_Callback);
+
+    /*The frames are exchanged by the SPI transaction engine which enables the
+      interrupts only while a transaction is in flight*/
 
     /*Give the SPI interrupt higher priority as it's more important*/
     MCAL_NVIC_SetPriority(NVIC_SPI1_IVT_INDEX, NVIC_PRIORITY_5);
 
     /*Exit Gate SPI*/
 	  MCAL_SPI_Init(EXIT_GATE_ECU_SPI, &config);
-    
-    MCAL_SPI_Interrupt_EN(EXIT_GATE_ECU_SPI, SPI_IRQ_TXEIE, EXIT_GATE_ECU_SPI_TXEmpty_ISR_Callback);
 
     /*Give the SPI interrupt higher priority as it's more important*/
-    MCAL_NVIC_SetPriority(NVIC_SPI1_IVT_INDEX, NVIC_PRIORITY_6);
+    MCAL_NVIC_SetPriority(NVIC_SPI2_IVT_INDEX, NVIC_PRIORITY_6);
 }
 
 void EXTI_Init(void)
@@ -273,6 +1344,9 @@ void st_GatesComm_Init(void)
     /*Initialize the SPI module to communicate with the gates ECUs*/
     SPI_Init();
 
+    /*Start the cycle counter the failures buckets are refilled by*/
+    MCAL_DWT_Init();
+
     /*Initialize the EXTI module to communicate with the gates ECUs*/
     EXTI_Init();
 
@@ -293,6 +1367,26 @@ void st_GatesComm_Init(void)
 void st_GatesComm_CheckPendingRequests(void)
 {
     sGateRequestInfo_t request;
+    uint32 LOC_u32PriMask;
+
+    /*Push the pending cache updates to the gates*/
+    GatesComm_ServiceLink(&Glob_sEntranceGateLink, ENTRANCE_GATE_ECU_SyncComplete_Callback);
+    GatesComm_ServiceLink(&Glob_sExitGateLink, EXIT_GATE_ECU_SyncComplete_Callback);
+
+    /*Count the vehicles the gates opened for from their cache or while offline*/
+    GatesComm_CountReportedVehicles(&Glob_sEntranceGateLink);
+    GatesComm_CountReportedVehicles(&Glob_sExitGateLink);
+
+    GatesComm_UpdateClock();
+
+    /*Refill the failures buckets before the cycle counter wraps, the SPI ISRs take tokens too*/
+    LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+    (void)GatesComm_RefillFailBucket(&Glob_sEntranceGateLink);
+    (void)GatesComm_RefillFailBucket(&Glob_sExitGateLink);
+    MCAL_NVIC_ExitCritical(LOC_u32PriMask);
+
+    /*A slot freed up by an exit goes to the first waiting driver, the ones the gate gave up on leave*/
+    GatesComm_AdmitWaitingDriver();
 
     /*If there are any requests in the queue start processing them*/
     if(Glob_sQueueBuffer.size > 0)
@@ -302,6 +1396,8 @@ void st_GatesComm_CheckPendingRequests(void)
 
         /*Save the gate address*/
         Glob_u8ServedRequestGateAddress = request.GateAddress;
+        memcpy(Glob_au8ServedRequestID, request.szDriverID, AUTHORIZED_ID_SIZE);
+        Glob_boolServingRequest = TRUE;
 
         AI_GC_SendIDForAuthentication(request.szDriverID);
 
@@ -315,75 +1411,23 @@ void st_GatesComm_CheckPendingRequests(void)
  */
 void st_GatesComm_SendIDApprovedSignal(void)
 {
-    uint16 LOC_u16TxBuffer = Glob_u8ServedRequestGateAddress;
-    uint8 LOC_u8FailedTransmissionCount = 0;
-    volatile SPI_Typedef* SPIx;
-    fptr_Callback callback;
-
-    /*Determine which SPI instance to used based on the gate being served*/
-    if(Glob_u8ServedRequestGateAddress == ENTRANCE_GATE_ECU_ADDRESS)
+    /*Send the authentication code, retry in the next pass if the gate link is busy*/
+    if((Glob_u8ServedRequestGateAddress == ENTRANCE_GATE_ECU_ADDRESS) && (GatesComm_FreeSlots() == 0))
     {
-        SPIx = ENTRANCE_GATE_ECU_SPI;
-        callback = ENTRANCE_GATE_ECU_SPI_TXEmpty_ISR_Callback;
-
-        /* Decrease the number of slots available on the 7-segment display
-           note: if the number of available slots is 0 (garage full) the 
-           gate will open but the number of available slots won't change*/
-        if(Glob_u8AvailableSlots > 0)
-        {
-          HAL_SevenSeg_Decrement();
-          Glob_u8AvailableSlots--;
-        }else{
-
-        }
-    }else{
-        SPIx = EXIT_GATE_ECU_SPI;
-
-        callback = EXIT_GATE_ECU_SPI_TXEmpty_ISR_Callback;
-
-        /*Increase the number of slots available on the 7-segment display
-          note: if the number of available slots is 3 (garage empty) the 
-          gate will open but the number of available slots won't change*/
-        if(Glob_u8AvailableSlots < NUMBER_OF_GARAGE_SLOTS)
+        /*No slot is free, the driver waits for the next one*/
+        if(GatesComm_SendAuthenticationResult(GATE_REPLY_WAITLISTED, GATE_RESULT_REASON_NONE) == E_OK)
         {
-          HAL_SevenSeg_Increment();
-          Glob_u8AvailableSlots++;
-
+            fptr_GateCommState = st_GatesComm_CheckPendingRequests;
         }else{
 
         }
-    }
-        
-    /*Disable the interrupts to send the signal using polling*/
-    MCAL_SPI_Interrupt_Disable(SPIx, SPI_IRQ_TXEIE);
-
-    do
-    {
-        LOC_u16TxBuffer = Glob_u8ServedRequestGateAddress;
-
-        /*Send the address of the gate being served to act as the start of the frame*/
-        MCAL_SPI_ExchangeData(SPIx, (uint16 *)&LOC_u16TxBuffer);
 
-        /*Put a limit on the number of failed tries to avoid getting stuck in this loop*/
-        LOC_u8FailedTransmissionCount++;
+    }else if(GatesComm_SendAuthenticationResult(AUTHENTICATION_RESULT_PASS, GATE_RESULT_REASON_NONE) == E_OK){
 
-    } while ((LOC_u16TxBuffer != Glob_u8ServedRequestGateAddress) && 
-              LOC_u8FailedTransmissionCount < 10);
-    
-    /*Check if we failed to get an aknowledge from the slave then abort*/
-    if(LOC_u8FailedTransmissionCount < 10)
-    {
-        /*Send the successful authentication code*/
-        LOC_u16TxBuffer = AUTHENTICATION_RESULT_PASS;
-        MCAL_SPI_SendData(SPIx, &LOC_u16TxBuffer, PollingEnable);
+        fptr_GateCommState = st_GatesComm_CheckPendingRequests;
     }else{
 
     }
-
-    /*Enable the interrupts again*/
-    MCAL_SPI_Interrupt_EN(SPIx, SPI_IRQ_TXEIE, callback);
-
-    fptr_GateCommState = st_GatesComm_CheckPendingRequests;
 }
 
 /**
@@ -392,53 +1436,13 @@ void st_GatesComm_SendIDApprovedSignal(void)
  */
 void st_GatesComm_SendIDDisapprovedSignal(void)
 {
-    uint16 LOC_u16TxBuffer = Glob_u8ServedRequestGateAddress;
-    uint8 LOC_u8FailedTransmissionCount = 0;
-    volatile SPI_Typedef* SPIx;
-    fptr_Callback callback;
-
-    /*Determine which SPI instance to used based on the gate being served*/
-    if(Glob_u8ServedRequestGateAddress == ENTRANCE_GATE_ECU_ADDRESS)
-    {
-        SPIx = ENTRANCE_GATE_ECU_SPI;
-        callback = ENTRANCE_GATE_ECU_SPI_TXEmpty_ISR_Callback;
-
-    }else{
-
-        SPIx = EXIT_GATE_ECU_SPI;
-        callback = EXIT_GATE_ECU_SPI_TXEmpty_ISR_Callback;
-    }
-        
-
-    /*Disable the interrupts to send the signal using polling*/
-    MCAL_SPI_Interrupt_Disable(SPIx, SPI_IRQ_TXEIE);
-
-    do
-    {
-        LOC_u16TxBuffer = Glob_u8ServedRequestGateAddress;
-
-        /*Send the address of the gate being served to act as the start of the frame*/
-        MCAL_SPI_ExchangeData(SPIx, (uint16 *)&LOC_u16TxBuffer);
-
-        /*Put a limit on the number of failed tries to avoid getting stuck in this loop*/
-        LOC_u8FailedTransmissionCount++;
-
-    } while ((LOC_u16TxBuffer != Glob_u8ServedRequestGateAddress) &&
-              LOC_u8FailedTransmissionCount < 10);
-    
-    if(LOC_u8FailedTransmissionCount < 10)
+    /*Send the failed authentication code, retry in the next pass if the gate link is busy*/
+    if(GatesComm_SendAuthenticationResult(AUTHENTICATION_RESULT_FAIL, GATE_RESULT_REASON_NOT_AUTHORIZED) == E_OK)
     {
-        /*Send the failed authentication code*/
-        LOC_u16TxBuffer = AUTHENTICATION_RESULT_FAIL;
-        MCAL_SPI_SendData(SPIx, &LOC_u16TxBuffer, PollingEnable);
+        fptr_GateCommState = st_GatesComm_CheckPendingRequests;
     }else{
 
     }
-
-    /*Enable the interrupts again*/
-    MCAL_SPI_Interrupt_EN(SPIx, SPI_IRQ_TXEIE, callback);
-
-    fptr_GateCommState = st_GatesComm_CheckPendingRequests;
 }
 
 /** @defgroup Signals between the Admin_Interface and Gates_Communication modules
@@ -469,6 +1473,32 @@ void AI_GC_IDDisapproved(void)
     fptr_GateCommState = st_GatesComm_SendIDDisapprovedSignal;
 }
 
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_AuthorizedIDAdded
+* @brief		   :  Function to inform that a new ID was added to the list of authorized IDs.
+* @param [in]	:  ptr_DriverID: pointer to the array holding the Driver ID
+* @note			:  The update is pushed to the authorization cache of the gates.
+======================================================================================================================
+*/
+void AI_GC_AuthorizedIDAdded(uint8* ptr_DriverID)
+{
+    GatesComm_LogCacheUpdate(GATE_CACHE_OP_ADD, ptr_DriverID);
+}
+
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_AuthorizedIDRemoved
+* @brief		   :  Function to inform that an ID was removed from the list of authorized IDs.
+* @param [in]	:  ptr_DriverID: pointer to the array holding the Driver ID
+* @note			:  The update is pushed to the authorization cache of the gates.
+======================================================================================================================
+*/
+void AI_GC_AuthorizedIDRemoved(uint8* ptr_DriverID)
+{
+    GatesComm_LogCacheUpdate(GATE_CACHE_OP_REMOVE, ptr_DriverID);
+}
+
 /**
   * @}
   */
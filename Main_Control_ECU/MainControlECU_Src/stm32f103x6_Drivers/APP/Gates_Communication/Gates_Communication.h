@@ -35,6 +35,7 @@
   */
 #include "SPI/stm32f103x8_SPI.h"
 #include "EXTI/stm32f103x6_EXTI.h"
+#include "DWT/Cortex_m3_DWT_Interface.h"
 /**
   * @}
   */
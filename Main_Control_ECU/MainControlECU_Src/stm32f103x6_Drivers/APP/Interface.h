@@ -39,6 +39,16 @@
    * @}
    */
 
+/** @defgroup AUTHORIZED_ID_LOOKUP
+   * @{
+   */
+#define AI_LOOKUP_NOT_FOUND         0u
+#define AI_LOOKUP_FOUND             1u
+#define AI_LOOKUP_UNAVAILABLE       2u      /*The list is being changed, the ID must be authenticated through the queue*/
+ /**
+   * @}
+   */
+
 
 /** @defgroup Signals between the Admin_Interface and Gates_Communication modules
   * @{
@@ -63,6 +73,49 @@ void st_Admin_AuthenticateID(void);
 */
 void AI_GC_SendIDForAuthentication(uint8* ptr_DriverID);
 
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_GetAuthorizedID
+* @brief		   :  Function to read an ID from the list of authorized IDs.
+* @param [in]	:  copy_u8Index: index of the ID in the list.
+* @param [out]	:  ptr_DriverID: array of AUTHORIZED_ID_SIZE characters to copy the ID into.
+* @return     :  E_OK if the index is in the list, E_NOK otherwise.
+* @note			:  The order of the list changes when an ID is removed.
+======================================================================================================================
+*/
+eStatus_t AI_GC_GetAuthorizedID(uint8 copy_u8Index, uint8* ptr_DriverID);
+
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_LookupID
+* @brief		   :  Function to check an ID against the list of authorized IDs through its hash index.
+* @param [in]	:  ptr_DriverID: array of AUTHORIZED_ID_SIZE characters holding the Driver ID.
+* @return     :  Must be a value of @ref AUTHORIZED_ID_LOOKUP.
+* @note			:  Takes a few compares whatever the size of the list, it's safe to call from an ISR.
+======================================================================================================================
+*/
+uint8 AI_GC_LookupID(const uint8* ptr_DriverID);
+
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_AuthorizedIDAdded
+* @brief		   :  Function to inform that a new ID was added to the list of authorized IDs.
+* @param [in]	:  ptr_DriverID: pointer to the array holding the Driver ID
+* @note			:  The update is pushed to the authorization cache of the gates.
+======================================================================================================================
+*/
+void AI_GC_AuthorizedIDAdded(uint8* ptr_DriverID);
+
+/**
+======================================================================================================================
+* @Func_name	:  AI_GC_AuthorizedIDRemoved
+* @brief		   :  Function to inform that an ID was removed from the list of authorized IDs.
+* @param [in]	:  ptr_DriverID: pointer to the array holding the Driver ID
+* @note			:  The update is pushed to the authorization cache of the gates.
+======================================================================================================================
+*/
+void AI_GC_AuthorizedIDRemoved(uint8* ptr_DriverID);
+
 /**
 ======================================================================================================================
 * @Func_name	:  AI_GC_IDApproved
@@ -8,6 +8,9 @@
 #define CPU_BYTE_ORDER LOW_BYTE_FIRST
 
 /*--------Types------------*/
+#ifndef NULL
+#define NULL                ((void *)0)
+#endif
 
 typedef unsigned char       boolean;
 #define TRUE                (1U)
@@ -0,0 +1,61 @@
+/**
+ * @name    Cortex_m3_DWT_Interface.h
+ * @brief   The DWT cycle counter is a free running 32-bit counter of the core clock cycles, it's used as a
+ *          time base that doesn't take the SysTick timer.
+ * @date    Created on: Oct 18, 2026
+ * @author  Hossam Eid
+ */
+
+#ifndef MCAL_DWT_CORTEX_M3_DWT_INTERFACE_H_
+#define MCAL_DWT_CORTEX_M3_DWT_INTERFACE_H_
+
+/** @defgroup INCLUDES
+  * @{
+  */
+#include "Platform_Types.h"
+#include "RCC/stm32f103x6_RCC.h"
+
+/**
+  * @}
+  */
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Supported by "MCAL DWT DRIVER"
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_DWT_Init
+* @brief		  :   Function to power the DWT unit and start its cycle counter.
+* @param [in]	:   none.
+* @return     :   none.
+* @note			  :   The counter isn't reset if it's already running, so every module can call it.
+======================================================================================================================
+*/
+void MCAL_DWT_Init(void);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_DWT_GetCycles
+* @brief		  :   Function to return the current value of the cycle counter.
+* @param [in]	:   none.
+* @return     :   The cycle counter, it wraps every 2^32 / MCAL_DWT_GetCyclesPerMs() ms (about 536 s on the 8 MHz HSI).
+* @note			  :   Take the difference of two readings as uint32 to get the elapsed cycles across a wrap.
+======================================================================================================================
+*/
+uint32 MCAL_DWT_GetCycles(void);
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_DWT_GetCyclesPerMs
+* @brief		  :   Function to return the number of cycle counter ticks in one millisecond.
+* @param [in]	:   none.
+* @return     :   The core clock frequency in kHz.
+* @note			  :   none.
+======================================================================================================================
+*/
+uint32 MCAL_DWT_GetCyclesPerMs(void);
+
+#endif /* MCAL_DWT_CORTEX_M3_DWT_INTERFACE_H_ */
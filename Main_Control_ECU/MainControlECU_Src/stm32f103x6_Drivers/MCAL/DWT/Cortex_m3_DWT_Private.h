@@ -0,0 +1,70 @@
+/**
+ * @name    Cortex_m3_DWT_Private.h
+ * @brief   
+ * @date    Created on: Oct 18, 2026
+ * @author  Hossam Eid
+ */
+
+#ifndef MCAL_DWT_CORTEX_M3_DWT_PRIVATE_H_
+#define MCAL_DWT_CORTEX_M3_DWT_PRIVATE_H_
+
+/**************************************************************************************************************************
+*===============================================
+* Includes
+*===============================================
+*/
+#include "Platform_Types.h"
+
+
+/**************************************************************************************************************************
+*===============================================
+*           User type definitions 
+*===============================================
+*/
+
+/**
+ * @brief This structure contains the DWT registers used by the driver.
+ * 
+ */
+typedef struct{
+    vuint32_t CTRL;         /**!<DWT Control Register>*/
+    vuint32_t CYCCNT;       /**!<DWT Cycle Count Register>*/
+}sDWT_Typedef;
+
+
+/**************************************************************************************************************************
+*===============================================
+*               DWT_INSTANCE
+*===============================================
+*/
+#define DWT_BASE        0xE0001000UL                            /*!<DWT Base Address>*/
+#define DWT             ((volatile sDWT_Typedef *)(DWT_BASE))   /*!<DWT Instance>*/
+
+#define DEMCR           (*((vuint32_t *)0xE000EDFCUL))          /*!<Debug Exception and Monitor Control Register>*/
+
+
+/**************************************************************************************************************************
+*===============================================
+*        DWT_REGISTERS_BIT_DEFENITIONS
+*===============================================
+*/
+
+/** @defgroup DWT_CTRL
+  * @{
+  */
+#define DWT_CTRL_CYCCNTENA_POS      0                               /*!<Cycle Counter Enable Bit Postion>*/
+#define DWT_CTRL_CYCCNTENA_MASK     (1UL << DWT_CTRL_CYCCNTENA_POS) /*!<Cycle Counter Enable Bit Mask>*/
+/**
+  * @}
+  */
+
+/** @defgroup DEMCR
+  * @{
+  */
+#define DEMCR_TRCENA_POS            24                              /*!<Trace Enable Bit Postion>*/
+#define DEMCR_TRCENA_MASK           (1UL << DEMCR_TRCENA_POS)       /*!<Trace Enable Bit Mask, powers the DWT>*/
+/**
+  * @}
+  */
+
+#endif /* MCAL_DWT_CORTEX_M3_DWT_PRIVATE_H_ */
@@ -0,0 +1,72 @@
+/**
+ * @name    Cortex_m3_DWT_Program.c
+ * @brief   
+ * @date    Created on: Oct 18, 2026
+ * @author  Hossam Eid
+ */
+
+/**************************************************************************************************************************
+*===============================================
+* Includes
+*===============================================
+*/
+#include "Cortex_m3_DWT_Interface.h"
+#include "Cortex_m3_DWT_Private.h"
+
+
+/**************************************************************************************************************************
+===============================================
+*       APIs Definition
+*===============================================
+*/
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_DWT_Init
+* @brief		:   Function to power the DWT unit and start its cycle counter.
+* @param [in]	:   none.
+* @return       :   none.
+* @note			:   The counter isn't reset if it's already running, so every module can call it.
+======================================================================================================================
+*/
+void MCAL_DWT_Init(void)
+{
+    if(!(DWT->CTRL & DWT_CTRL_CYCCNTENA_MASK))
+    {
+        /*The DWT registers can only be written once the trace unit is powered*/
+        DEMCR |= DEMCR_TRCENA_MASK;
+
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_MASK;
+    }else{
+
+    }
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_DWT_GetCycles
+* @brief		:   Function to return the current value of the cycle counter.
+* @param [in]	:   none.
+* @return       :   The cycle counter, it wraps every 2^32 / MCAL_DWT_GetCyclesPerMs() ms (about 536 s on the 8 MHz HSI).
+* @note			:   Take the difference of two readings as uint32 to get the elapsed cycles across a wrap.
+======================================================================================================================
+*/
+uint32 MCAL_DWT_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+======================================================================================================================
+* @Func_name	:   MCAL_DWT_GetCyclesPerMs
+* @brief		:   Function to return the number of cycle counter ticks in one millisecond.
+* @param [in]	:   none.
+* @return       :   The core clock frequency in kHz.
+* @note			:   none.
+======================================================================================================================
+*/
+uint32 MCAL_DWT_GetCyclesPerMs(void)
+{
+    return (MCAL_RCC_GET_HCLK() / 1000UL);
+}
@@ -51,20 +51,20 @@ void MCAL_EXTI_Enable(EXTI_config_t* EXTI_Config)
     MCAL_AFIO_EXTI_Init(EXTI_Config->PinConfig.EXTI_lineNumber, EXTI_Config->PinConfig.AFIO_Port_config);
 
     /*Clear the rising and falling edge triggers*/
-    CLEAR_BIT(EXTI->RTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
-    CLEAR_BIT(EXTI->FTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
+    BITBAND_CLEAR_BIT(EXTI->RTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
+    BITBAND_CLEAR_BIT(EXTI->FTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
 
     /*Configure the triggering edge of the interrupt*/
     if(EXTI_Config->EXTI_Trigger_Mode == EXTI_TRIGGER_RISING_EDGE ||
        EXTI_Config->EXTI_Trigger_Mode == EXTI_TRIGGER_BOTH_EDGES)
     {
-        SET_BIT(EXTI->RTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
+        BITBAND_SET_BIT(EXTI->RTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
     }
 
     if(EXTI_Config->EXTI_Trigger_Mode == EXTI_TRIGGER_FALLING_EDGE ||
        EXTI_Config->EXTI_Trigger_Mode == EXTI_TRIGGER_BOTH_EDGES)
     {
-        SET_BIT( EXTI->FTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
+        BITBAND_SET_BIT(EXTI->FTSR, EXTI_Config->PinConfig.EXTI_lineNumber);
     }
 
     /*Set the priority of the interrupt in NVIC*/
@@ -76,14 +76,14 @@ void MCAL_EXTI_Enable(EXTI_config_t* EXTI_Config)
     if(EXTI_Config->EXTI_En == EXTI_ENABLE)
     {
         /*Enable the interrupt mask in the EXTI peripheral*/
-        SET_BIT(EXTI->IMR, EXTI_Config->PinConfig.EXTI_lineNumber);
+        BITBAND_SET_BIT(EXTI->IMR, EXTI_Config->PinConfig.EXTI_lineNumber);
 
         /*Enable the interrupt mask in the NVIC peripheral*/
         MCAL_NVIC_EnableIRQ(EXTI_Config->PinConfig.EXTI_IVT_index);
     }else
     {
         /*Disable the interrupt mask in the EXTI peripheral*/
-        CLEAR_BIT(EXTI->IMR, EXTI_Config->PinConfig.EXTI_lineNumber);
+        BITBAND_CLEAR_BIT(EXTI->IMR, EXTI_Config->PinConfig.EXTI_lineNumber);
 
         /*Disable the interrupt mask in the NVIC peripheral*/
         MCAL_NVIC_DisableIRQ(EXTI_Config->PinConfig.EXTI_IVT_index);
@@ -117,7 +117,7 @@ void MCAL_EXTI_Update_Config(EXTI_config_t* EXTI_Config)
 void MCAL_EXTI_Disable(uint8 EXTI_lineNumber, uint8 EXTI_IVT_index)
 {
     /*Disable the interrupt mask in the EXTI peripheral*/
-    CLEAR_BIT(EXTI->IMR, EXTI_lineNumber);
+    BITBAND_CLEAR_BIT(EXTI->IMR, EXTI_lineNumber);
 
     /*Disable the interrupt mask in the NVIC peripheral*/
     MCAL_NVIC_DisableIRQ(EXTI_IVT_index);
@@ -161,8 +161,8 @@ void MCAL_EXTI_Reset()
 /*-----------@defgroup EXTI ISR------------------------ */
 void EXTI0_IRQHandler(void)
 {
-    /*Clear the pending bit in EXTI_PR */
-    SET_BIT(EXTI->PR, 0);
+    /*Clear the pending bit in EXTI_PR (write-1-to-clear)*/
+    EXTI->PR = (1UL << 0);
     
     /*Jump to the ISR*/
     GP_callback_func[0]();
@@ -170,8 +170,8 @@ void EXTI0_IRQHandler(void)
 
 void EXTI1_IRQHandler(void)
 {
-    /*Clear the pending bit in EXTI_PR */
-    SET_BIT(EXTI->PR, 1);
+    /*Clear the pending bit in EXTI_PR (write-1-to-clear)*/
+    EXTI->PR = (1UL << 1);
     
     /*Jump to the ISR*/
     GP_callback_func[1]();
@@ -179,8 +179,8 @@ void EXTI1_IRQHandler(void)
 
 void EXTI2_IRQHandler(void)
 {
-    /*Clear the pending bit in EXTI_PR */
-    SET_BIT(EXTI->PR, 2);
+    /*Clear the pending bit in EXTI_PR (write-1-to-clear)*/
+    EXTI->PR = (1UL << 2);
     
     /*Jump to the ISR*/
     GP_callback_func[2]();
@@ -188,8 +188,8 @@ void EXTI2_IRQHandler(void)
 
 void EXTI3_IRQHandler(void)
 {
-    /*Clear the pending bit in EXTI_PR */
-    SET_BIT(EXTI->PR, 3);
+    /*Clear the pending bit in EXTI_PR (write-1-to-clear)*/
+    EXTI->PR = (1UL << 3);
     
     /*Jump to the ISR*/
     GP_callback_func[3]();
@@ -197,8 +197,8 @@ void EXTI3_IRQHandler(void)
 
 void EXTI4_IRQHandler(void)
 {
-    /*Clear the pending bit in EXTI_PR */
-    SET_BIT(EXTI->PR, 4);
+    /*Clear the pending bit in EXTI_PR (write-1-to-clear)*/
+    EXTI->PR = (1UL << 4);
     
     /*Jump to the ISR*/
     GP_callback_func[4]();
@@ -206,19 +206,19 @@ void EXTI4_IRQHandler(void)
 
 void EXTI9_5_IRQHandler(void)
 {
-    if(READ_BIT(EXTI->PR, 5) == 1){SET_BIT(EXTI->PR, 5); GP_callback_func[5]();}
-    if(READ_BIT(EXTI->PR, 6) == 1){SET_BIT(EXTI->PR, 6); GP_callback_func[6]();}
-    if(READ_BIT(EXTI->PR, 7) == 1){SET_BIT(EXTI->PR, 7); GP_callback_func[7]();}
-    if(READ_BIT(EXTI->PR, 8) == 1){SET_BIT(EXTI->PR, 8); GP_callback_func[8]();}
-    if(READ_BIT(EXTI->PR, 9) == 1){SET_BIT(EXTI->PR, 9); GP_callback_func[9]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 5)){EXTI->PR = (1UL << 5); GP_callback_func[5]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 6)){EXTI->PR = (1UL << 6); GP_callback_func[6]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 7)){EXTI->PR = (1UL << 7); GP_callback_func[7]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 8)){EXTI->PR = (1UL << 8); GP_callback_func[8]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 9)){EXTI->PR = (1UL << 9); GP_callback_func[9]();}
 }
 
 void EXTI15_10_IRQHandler(void)
 {
-    if(READ_BIT(EXTI->PR, 10) == 1){SET_BIT(EXTI->PR, 10); GP_callback_func[10]();}
-    if(READ_BIT(EXTI->PR, 11) == 1){SET_BIT(EXTI->PR, 11); GP_callback_func[11]();}
-    if(READ_BIT(EXTI->PR, 12) == 1){SET_BIT(EXTI->PR, 12); GP_callback_func[12]();}
-    if(READ_BIT(EXTI->PR, 13) == 1){SET_BIT(EXTI->PR, 13); GP_callback_func[13]();}
-    if(READ_BIT(EXTI->PR, 14) == 1){SET_BIT(EXTI->PR, 14); GP_callback_func[14]();}
-    if(READ_BIT(EXTI->PR, 15) == 1){SET_BIT(EXTI->PR, 15); GP_callback_func[15]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 10)){EXTI->PR = (1UL << 10); GP_callback_func[10]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 11)){EXTI->PR = (1UL << 11); GP_callback_func[11]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 12)){EXTI->PR = (1UL << 12); GP_callback_func[12]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 13)){EXTI->PR = (1UL << 13); GP_callback_func[13]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 14)){EXTI->PR = (1UL << 14); GP_callback_func[14]();}
+    if(BITBAND_READ_BIT(EXTI->PR, 15)){EXTI->PR = (1UL << 15); GP_callback_func[15]();}
 }
\ No newline at end of file
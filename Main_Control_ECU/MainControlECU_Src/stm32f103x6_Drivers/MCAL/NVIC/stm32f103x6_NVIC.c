@@ -157,3 +157,37 @@ uint8 MCAL_NVIC_GetPriority (uint8 IRQn)
 
     return priority;
 }
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_NVIC_EnterCritical
+* @brief		:   Mask all the configurable interrupts and return the previous mask state.
+* @param [in]	:   none.
+* @return_value :   The previous PRIMASK value, to be given back to MCAL_NVIC_ExitCritical.
+* Note			:   Critical sections nest, only the outermost exit unmasks the interrupts. Safe to call from
+*                   the main loop and from any ISR.
+======================================================================================================================
+*/
+uint32 MCAL_NVIC_EnterCritical(void)
+{
+    uint32 LOC_u32PriMask;
+
+    __asm volatile ("MRS %0, PRIMASK" : "=r" (LOC_u32PriMask));
+    __asm volatile ("CPSID I" : : : "memory");
+
+    return LOC_u32PriMask;
+}
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_NVIC_ExitCritical
+* @brief		:   Restore the interrupt mask state saved by MCAL_NVIC_EnterCritical.
+* @param [in]	:   copy_u32PriMask: the value returned by the matching MCAL_NVIC_EnterCritical.
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+void MCAL_NVIC_ExitCritical(uint32 copy_u32PriMask)
+{
+    __asm volatile ("MSR PRIMASK, %0" : : "r" (copy_u32PriMask) : "memory");
+}
@@ -201,4 +201,27 @@ void MCAL_NVIC_SetPriority (uint8 IRQn, uint8 priority);
 */
 uint8 MCAL_NVIC_GetPriority (uint8 IRQn);
 
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_NVIC_EnterCritical
+* @brief		:   Mask all the configurable interrupts and return the previous mask state.
+* @param [in]	:   none.
+* @return_value :   The previous PRIMASK value, to be given back to MCAL_NVIC_ExitCritical.
+* Note			:   Critical sections nest, only the outermost exit unmasks the interrupts. Safe to call from
+*                   the main loop and from any ISR.
+======================================================================================================================
+*/
+uint32 MCAL_NVIC_EnterCritical(void);
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_NVIC_ExitCritical
+* @brief		:   Restore the interrupt mask state saved by MCAL_NVIC_EnterCritical.
+* @param [in]	:   copy_u32PriMask: the value returned by the matching MCAL_NVIC_EnterCritical.
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+void MCAL_NVIC_ExitCritical(uint32 copy_u32PriMask);
+
 #endif /* MCAL_NVIC_STM32F103X6_NVIC_H_ */
@@ -39,6 +39,24 @@ static SPI_Config_t SPI_Config[2];
 static void (* p_IRQ_callback_SPI1[3])(void);
 static void (* p_IRQ_callback_SPI2[3])(void);
 
+/**
+ * @brief Holds the state of the transaction engine of one SPI instance.
+ * 
+ */
+typedef struct{
+    sSPI_Transaction_t* psQueue[SPI_TRANSACTION_QUEUE_SIZE];    /*Pending transactions (circular buffer)*/
+    uint8 u8QueueHead;                                          /*Index of the oldest pending transaction*/
+    uint8 u8QueueCount;                                         /*Number of pending transactions*/
+    sSPI_Transaction_t* psCurrent;                              /*Transaction in flight, NULL when the engine is idle*/
+    uint16 u16FrameIndex;                                       /*Index of the frame in flight*/
+    uint8 u8Retries;                                            /*Number of restarts of the transaction in flight*/
+    volatile GPIO_t* CS_Port;                                   /*Slave select of the chain in flight*/
+    uint16 CS_Pin;
+}sSPI_TransactionEngine_t;
+
+static sSPI_TransactionEngine_t Glob_sTransactionEngine[2];
+static sSPI_ErrorCounters_t Glob_sErrorCounters[2];
+
 /**************************************************************************************************************************
 ===============================================
 *  				Local functions
@@ -179,6 +197,274 @@ static void MCAL_SPI_GPIO_Set_Pins(volatile SPI_Typedef * SPIx)
 
 }
 
+/*
+======================================================================================================================
+* @Func_name	:   SPI_Transaction_SendFrame
+* @brief		:   Write the next frame of the transaction in flight to the data register.
+* @param [in]	:   SPIx: specifies the SPI instance (SPI1, SPI2).
+* @param [in]	:   engine: the transaction engine of the instance.
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+static void SPI_Transaction_SendFrame(volatile SPI_Typedef * SPIx, sSPI_TransactionEngine_t* engine)
+{
+    sSPI_Transaction_t* LOC_psTransaction = engine->psCurrent;
+
+    LOC_psTransaction->eStatus = SPI_TRANSACTION_IN_FLIGHT;
+
+    if(LOC_psTransaction->pu8TxBuffer != NULL)
+    {
+        SPIx->DR = LOC_psTransaction->pu8TxBuffer[engine->u16FrameIndex];
+    }else{
+        SPIx->DR = SPI_TRANSACTION_DUMMY_FRAME;
+    }
+}
+
+/*
+======================================================================================================================
+* @Func_name	:   SPI_Transaction_StartNext
+* @brief		:   Start the oldest pending transaction or put the engine to rest if there is none.
+* @param [in]	:   SPIx: specifies the SPI instance (SPI1, SPI2).
+* @param [in]	:   engine: the transaction engine of the instance.
+* @return_value :   none.
+* Note			:   Must be called with the instance interrupt masked or from its ISR.
+======================================================================================================================
+*/
+static void SPI_Transaction_StartNext(volatile SPI_Typedef * SPIx, sSPI_TransactionEngine_t* engine)
+{
+    if(engine->u8QueueCount > 0)
+    {
+        engine->psCurrent = engine->psQueue[engine->u8QueueHead];
+        engine->u8QueueHead = (engine->u8QueueHead + 1) % SPI_TRANSACTION_QUEUE_SIZE;
+        engine->u8QueueCount--;
+
+        engine->u16FrameIndex = 0;
+        engine->u8Retries = 0;
+
+        /*Select the slave for the whole chain*/
+        engine->CS_Port = engine->psCurrent->CS_Port;
+        engine->CS_Pin = engine->psCurrent->CS_Pin;
+        if(engine->CS_Port != NULL)
+        {
+            MCAL_GPIO_WritePin(engine->CS_Port, engine->CS_Pin, GPIO_PIN_LOW);
+        }else{
+
+        }
+
+        /*Drop any stale frame so the first RXNE belongs to this transaction, reading SR after DR also
+          clears an OVR flag left set by the stale frame*/
+        (void)SPIx->DR;
+        (void)SPIx->SR;
+
+        BITBAND_SET_BIT(SPIx->CR2, SPI_IRQ_CR2_BIT_POS(SPI_IRQ_RXNEIE));
+        BITBAND_SET_BIT(SPIx->CR2, SPI_IRQ_CR2_BIT_POS(SPI_IRQ_ERRIE));
+
+        SPI_Transaction_SendFrame(SPIx, engine);
+    }else{
+        engine->psCurrent = NULL;
+
+        /*Nothing to exchange, keep the interrupts quiet*/
+        BITBAND_CLEAR_BIT(SPIx->CR2, SPI_IRQ_CR2_BIT_POS(SPI_IRQ_RXNEIE));
+        BITBAND_CLEAR_BIT(SPIx->CR2, SPI_IRQ_CR2_BIT_POS(SPI_IRQ_ERRIE));
+    }
+}
+
+/*
+======================================================================================================================
+* @Func_name	:   SPI_Transaction_Finish
+* @brief		:   End the transaction in flight, continue its chain if it's done or abort the rest of the chain
+*                   if it's aborted, then notify the owners and start the next pending transaction.
+* @param [in]	:   SPIx: specifies the SPI instance (SPI1, SPI2).
+* @param [in]	:   engine: the transaction engine of the instance.
+* @param [in]	:   status: must be SPI_TRANSACTION_DONE or SPI_TRANSACTION_ABORTED.
+* @return_value :   none.
+* Note			:   The callbacks of an aborted chain are called in chain order once the whole chain is marked aborted.
+======================================================================================================================
+*/
+static void SPI_Transaction_Finish(volatile SPI_Typedef * SPIx, sSPI_TransactionEngine_t* engine, 
+                                   eSPI_TransactionStatus_t status)
+{
+    sSPI_Transaction_t* LOC_psTransaction = engine->psCurrent;
+    sSPI_Transaction_t* LOC_psChained;
+    sSPI_Transaction_t* LOC_psNextChained;
+
+    LOC_psTransaction->eStatus = status;
+
+    /*The transactions chained behind an aborted one never run, they end aborted too*/
+    LOC_psChained = (status == SPI_TRANSACTION_ABORTED)? LOC_psTransaction->psNext : NULL;
+
+    for(LOC_psNextChained = LOC_psChained; LOC_psNextChained != NULL; LOC_psNextChained = LOC_psNextChained->psNext)
+    {
+        LOC_psNextChained->eStatus = SPI_TRANSACTION_ABORTED;
+    }
+
+    if((status == SPI_TRANSACTION_DONE) && (LOC_psTransaction->psNext != NULL))
+    {
+        /*Chained transfer: continue with the slave still selected*/
+        engine->psCurrent = LOC_psTransaction->psNext;
+        engine->u16FrameIndex = 0;
+        engine->u8Retries = 0;
+        SPI_Transaction_SendFrame(SPIx, engine);
+    }else{
+        if(engine->CS_Port != NULL)
+        {
+            MCAL_GPIO_WritePin(engine->CS_Port, engine->CS_Pin, GPIO_PIN_HIGH);
+        }else{
+
+        }
+
+        engine->psCurrent = NULL;
+    }
+
+    /*The callback may submit a new transaction which starts right away if the engine is idle*/
+    if(LOC_psTransaction->fptr_OnComplete != NULL)
+    {
+        LOC_psTransaction->fptr_OnComplete();
+    }else{
+
+    }
+
+    while(LOC_psChained != NULL)
+    {
+        /*Take the link first as the callback may submit the descriptor again*/
+        LOC_psNextChained = LOC_psChained->psNext;
+
+        if(LOC_psChained->fptr_OnComplete != NULL)
+        {
+            LOC_psChained->fptr_OnComplete();
+        }else{
+
+        }
+
+        LOC_psChained = LOC_psNextChained;
+    }
+
+    if(engine->psCurrent == NULL)
+    {
+        SPI_Transaction_StartNext(SPIx, engine);
+    }else{
+
+    }
+}
+
+/*
+======================================================================================================================
+* @Func_name	:   SPI_Transaction_RXNE_Handler
+* @brief		:   Store the received frame and move the transaction engine to the next frame, transaction or chain.
+* @param [in]	:   SPIx: specifies the SPI instance (SPI1, SPI2).
+* @param [in]	:   engine: the transaction engine of the instance.
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+static void SPI_Transaction_RXNE_Handler(volatile SPI_Typedef * SPIx, sSPI_TransactionEngine_t* engine)
+{
+    sSPI_Transaction_t* LOC_psTransaction = engine->psCurrent;
+    uint8 LOC_u8Frame;
+
+    /*Reading the data register clears the RXNE flag*/
+    LOC_u8Frame = (uint8)SPIx->DR;
+
+    if(LOC_psTransaction != NULL)
+    {
+        if(LOC_psTransaction->pu8RxBuffer != NULL)
+        {
+            LOC_psTransaction->pu8RxBuffer[engine->u16FrameIndex] = LOC_u8Frame;
+        }else{
+
+        }
+
+        engine->u16FrameIndex++;
+
+        if(engine->u16FrameIndex < LOC_psTransaction->u16Length)
+        {
+            SPI_Transaction_SendFrame(SPIx, engine);
+        }else{
+            SPI_Transaction_Finish(SPIx, engine, SPI_TRANSACTION_DONE);
+        }
+    }else{
+
+    }
+}
+
+/*
+======================================================================================================================
+* @Func_name	:   SPI_Transaction_ERR_Handler
+* @brief		:   Count the bus error, resynchronize the SPI instance and restart or abort the transaction in flight.
+* @param [in]	:   SPIx: specifies the SPI instance (SPI1, SPI2).
+* @param [in]	:   index: index of the instance (SPI1_INDEX, SPI2_INDEX).
+* @return_value :   none.
+* Note			:   An overrun leaves a stale frame in the data register and a mode fault clears the MSTR and SPE
+*                   bits, in both cases the frames of the transaction in flight can't be trusted anymore.
+======================================================================================================================
+*/
+static void SPI_Transaction_ERR_Handler(volatile SPI_Typedef * SPIx, uint8 index)
+{
+    sSPI_TransactionEngine_t* LOC_psEngine = &Glob_sTransactionEngine[index];
+    uint16 LOC_u16Status = SPIx->SR;
+
+    if(LOC_u16Status & SPI_SR_OVR)
+    {
+        /*Clear the OVR flag by reading DR then SR*/
+        (void)SPIx->DR;
+        (void)SPIx->SR;
+
+        Glob_sErrorCounters[index].u32OverrunCount++;
+    }else{
+
+    }
+
+    if(LOC_u16Status & SPI_SR_MODF)
+    {
+        /*The SR was read while MODF is set, writing CR1 clears it and restores the master mode*/
+        SPIx->CR1 |= (SPI_Config[index].SPI_Mode | SPI_CR1_SPE_SET);
+
+        Glob_sErrorCounters[index].u32ModeFaultCount++;
+    }else{
+
+    }
+
+    if(LOC_psEngine->psCurrent != NULL)
+    {
+        if(LOC_psEngine->u8Retries < LOC_psEngine->psCurrent->u8MaxRetries)
+        {
+            LOC_psEngine->u8Retries++;
+            Glob_sErrorCounters[index].u32RetryCount++;
+
+            /*Restart the transaction from its first frame*/
+            LOC_psEngine->u16FrameIndex = 0;
+            SPI_Transaction_SendFrame(SPIx, LOC_psEngine);
+        }else{
+            Glob_sErrorCounters[index].u32AbortCount++;
+
+            SPI_Transaction_Finish(SPIx, LOC_psEngine, SPI_TRANSACTION_ABORTED);
+        }
+    }else{
+
+    }
+}
+
+static void SPI1_Transaction_ERR_Callback(void)
+{
+    SPI_Transaction_ERR_Handler(SPI1, SPI1_INDEX);
+}
+
+static void SPI2_Transaction_ERR_Callback(void)
+{
+    SPI_Transaction_ERR_Handler(SPI2, SPI2_INDEX);
+}
+
+static void SPI1_Transaction_RXNE_Callback(void)
+{
+    SPI_Transaction_RXNE_Handler(SPI1, &Glob_sTransactionEngine[SPI1_INDEX]);
+}
+
+static void SPI2_Transaction_RXNE_Callback(void)
+{
+    SPI_Transaction_RXNE_Handler(SPI2, &Glob_sTransactionEngine[SPI2_INDEX]);
+}
+
 /**************************************************************************************************************************
 *===============================================
 *  			APIs functions definitions
@@ -208,6 +494,9 @@ void MCAL_SPI_Init(volatile SPI_Typedef* SPIx, SPI_Config_t* config)
         SPI_Config[SPI2_INDEX] = *config;
     }
 
+    /*The cycle counter measures the interrupt load of the instance*/
+    MCAL_DWT_Init();
+
     SPIx->CR1 = 0;  /*Reset the Register to its original state*/
 
     /* Configure SPIx: direction, NSS management, first transmitted bit, BaudRate prescaler
@@ -381,17 +670,32 @@ void MCAL_SPI_WAIT_TC(USART_Typedef * SPIx)
 */
 void MCAL_SPI_Interrupt_EN(volatile SPI_Typedef * SPIx, uint8 IRQ, void (* p_IRQ_callback)(void))
 {
+    uint8 LOC_u8BitPos;
+
+    for(LOC_u8BitPos = SPI_IRQ_CR2_FIRST_BIT; LOC_u8BitPos <= SPI_IRQ_CR2_LAST_BIT; LOC_u8BitPos++)
+    {
+        if(IRQ & (1u << LOC_u8BitPos))
+        {
+            if(SPIx == SPI1)
+            {
+                p_IRQ_callback_SPI1[LOC_u8BitPos - SPI_IRQ_CR2_FIRST_BIT] = p_IRQ_callback;
+            }else{
+                p_IRQ_callback_SPI2[LOC_u8BitPos - SPI_IRQ_CR2_FIRST_BIT] = p_IRQ_callback;
+            }
+
+            /*Enable the Interrupt in CR2*/
+            BITBAND_SET_BIT(SPIx->CR2, LOC_u8BitPos);
+        }else{
+
+        }
+    }
+
     if(SPIx == SPI1)
     {
         MCAL_NVIC_EnableIRQ(NVIC_SPI1_IVT_INDEX);
-        p_IRQ_callback_SPI1[IRQ >> 6] = p_IRQ_callback;
     }else{
         MCAL_NVIC_EnableIRQ(NVIC_SPI2_IVT_INDEX);
-        p_IRQ_callback_SPI2[IRQ >> 6] = p_IRQ_callback;
     }
-
-    /*Enable the Interrupt in CR2*/
-    SPIx->CR2 |= IRQ;
 }
 
 /*
@@ -406,18 +710,129 @@ void MCAL_SPI_Interrupt_EN(volatile SPI_Typedef * SPIx, uint8 IRQ, void (* p_IRQ
 */
 void MCAL_SPI_Interrupt_Disable(volatile SPI_Typedef * SPIx, uint8 IRQ)
 {
+    uint8 LOC_u8BitPos;
+
+    for(LOC_u8BitPos = SPI_IRQ_CR2_FIRST_BIT; LOC_u8BitPos <= SPI_IRQ_CR2_LAST_BIT; LOC_u8BitPos++)
+    {
+        if(IRQ & (1u << LOC_u8BitPos))
+        {
+            /*Disable the Interrupt in CR2*/
+            BITBAND_CLEAR_BIT(SPIx->CR2, LOC_u8BitPos);
+        }else{
+
+        }
+    }
+}
+
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_SPI_SubmitTransaction
+* @brief		:   Queue a transaction (or a chain of transactions) to be exchanged from the SPI ISR.
+* @param [in]	:   SPIx: specifies the SPI instance, can be (SPI1, SPI2).
+* @param [in]	:   transaction: the descriptor of the transaction, the head of the chain in case of chained transfers.
+* @return_value :   E_OK if the transaction was queued, E_NOK if the queue is full or the descriptor is invalid.
+* Note			:   The transactions of an instance run back to back in submission order using the RXNE and ERR
+*                   interrupts, so don't register your own callbacks or use the polling APIs on the same instance.
+*                   Only 8-bit frames are supported.
+======================================================================================================================
+*/
+eStatus_t MCAL_SPI_SubmitTransaction(volatile SPI_Typedef * SPIx, sSPI_Transaction_t* transaction)
+{
+    eStatus_t LOC_eStatus = E_NOK;
+    sSPI_TransactionEngine_t* LOC_psEngine;
+    uint32 LOC_u32PriMask;
+
     if(SPIx == SPI1)
     {
-        MCAL_NVIC_EnableIRQ(NVIC_SPI1_IVT_INDEX);
+        LOC_psEngine = &Glob_sTransactionEngine[SPI1_INDEX];
+        p_IRQ_callback_SPI1[SPI_IRQ_RXNEIE >> 6] = SPI1_Transaction_RXNE_Callback;
+        p_IRQ_callback_SPI1[SPI_IRQ_ERRIE >> 6] = SPI1_Transaction_ERR_Callback;
     }else{
-        MCAL_NVIC_EnableIRQ(NVIC_SPI2_IVT_INDEX);
+        LOC_psEngine = &Glob_sTransactionEngine[SPI2_INDEX];
+        p_IRQ_callback_SPI2[SPI_IRQ_RXNEIE >> 6] = SPI2_Transaction_RXNE_Callback;
+        p_IRQ_callback_SPI2[SPI_IRQ_ERRIE >> 6] = SPI2_Transaction_ERR_Callback;
+    }
+
+    if((transaction != NULL) && (transaction->u16Length > 0) &&
+       (transaction->eStatus != SPI_TRANSACTION_PENDING) && (transaction->eStatus != SPI_TRANSACTION_IN_FLIGHT))
+    {
+        /*Keep the ISRs away from the queue while it's being updated, the callers run at different
+          priorities so the mask state is saved and restored to allow nesting*/
+        LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+
+        if(LOC_psEngine->u8QueueCount < SPI_TRANSACTION_QUEUE_SIZE)
+        {
+            LOC_psEngine->psQueue[(LOC_psEngine->u8QueueHead + LOC_psEngine->u8QueueCount) % SPI_TRANSACTION_QUEUE_SIZE] = transaction;
+            LOC_psEngine->u8QueueCount++;
+            transaction->eStatus = SPI_TRANSACTION_PENDING;
+
+            if(LOC_psEngine->psCurrent == NULL)
+            {
+                SPI_Transaction_StartNext(SPIx, LOC_psEngine);
+            }else{
+
+            }
+
+            LOC_eStatus = E_OK;
+        }else{
+
+        }
+
+        MCAL_NVIC_ExitCritical(LOC_u32PriMask);
+    }else{
+
     }
 
-    /*Enable the Interrupt in CR2*/
-    SPIx->CR2 &= ~(IRQ);
+    return LOC_eStatus;
 }
 
 
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_SPI_GetErrorCounters
+* @brief		:   Get a snapshot of the link error counters of the transaction engine.
+* @param [in]	:   SPIx: specifies the SPI instance, can be (SPI1, SPI2).
+* @param [out]	:   counters: where the counters are copied.
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+void MCAL_SPI_GetErrorCounters(volatile SPI_Typedef * SPIx, sSPI_ErrorCounters_t* counters)
+{
+    uint8 index = (SPIx == SPI1)? SPI1_INDEX : SPI2_INDEX;
+    uint32 LOC_u32PriMask;
+
+    /*Take a consistent copy as the counters are updated from the ISR*/
+    LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+    *counters = Glob_sErrorCounters[index];
+    MCAL_NVIC_ExitCritical(LOC_u32PriMask);
+}
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_SPI_ClearErrorCounters
+* @brief		:   Reset the link error counters of the transaction engine to zero.
+* @param [in]	:   SPIx: specifies the SPI instance, can be (SPI1, SPI2).
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+void MCAL_SPI_ClearErrorCounters(volatile SPI_Typedef * SPIx)
+{
+    uint8 index = (SPIx == SPI1)? SPI1_INDEX : SPI2_INDEX;
+    uint32 LOC_u32PriMask;
+
+    LOC_u32PriMask = MCAL_NVIC_EnterCritical();
+    Glob_sErrorCounters[index].u32OverrunCount = 0;
+    Glob_sErrorCounters[index].u32ModeFaultCount = 0;
+    Glob_sErrorCounters[index].u32RetryCount = 0;
+    Glob_sErrorCounters[index].u32AbortCount = 0;
+    Glob_sErrorCounters[index].u32InterruptCount = 0;
+    Glob_sErrorCounters[index].u32InterruptCycles = 0;
+    MCAL_NVIC_ExitCritical(LOC_u32PriMask);
+}
+
 /**************************************************************************************************************************
 ===============================================
 *               SPI ISR functions
@@ -426,6 +841,8 @@ void MCAL_SPI_Interrupt_Disable(volatile SPI_Typedef * SPIx, uint8 IRQ)
 
 void SPI1_IRQHandler(void)
 {
+    uint32 LOC_u32StartCycles = MCAL_DWT_GetCycles();
+
     if((SPI1->CR2 & SPI_IRQ_ERRIE) && ((SPI1->SR & SPI_SR_OVR) || (SPI1->SR & SPI_SR_MODF)))
     {
         p_IRQ_callback_SPI1[SPI_IRQ_ERRIE >> 6]();
@@ -440,10 +857,15 @@ void SPI1_IRQHandler(void)
     {
         p_IRQ_callback_SPI1[SPI_IRQ_TXEIE >> 6]();
     }
+
+    Glob_sErrorCounters[SPI1_INDEX].u32InterruptCount++;
+    Glob_sErrorCounters[SPI1_INDEX].u32InterruptCycles += MCAL_DWT_GetCycles() - LOC_u32StartCycles;
 }
 
 void SPI2_IRQHandler(void)
 {
+    uint32 LOC_u32StartCycles = MCAL_DWT_GetCycles();
+
     if((SPI2->CR2 & SPI_IRQ_ERRIE) && ((SPI2->SR & SPI_SR_OVR) || (SPI2->SR & SPI_SR_MODF)))
     {
         p_IRQ_callback_SPI2[SPI_IRQ_ERRIE >> 6]();
@@ -458,4 +880,7 @@ void SPI2_IRQHandler(void)
     {
         p_IRQ_callback_SPI2[SPI_IRQ_TXEIE >> 6]();
     }
+
+    Glob_sErrorCounters[SPI2_INDEX].u32InterruptCount++;
+    Glob_sErrorCounters[SPI2_INDEX].u32InterruptCycles += MCAL_DWT_GetCycles() - LOC_u32StartCycles;
 }
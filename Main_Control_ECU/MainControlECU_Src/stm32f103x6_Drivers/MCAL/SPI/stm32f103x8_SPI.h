@@ -19,6 +19,7 @@
 #include "stm32f103x6.h"
 #include "GPIO/stm32f103x6_GPIO.h"
 #include "NVIC/stm32f103x6_NVIC.h"
+#include "DWT/Cortex_m3_DWT_Interface.h"
 
 /**************************************************************************************************************************
 *===============================================
@@ -53,6 +54,64 @@ typedef struct {
                           
 }SPI_Config_t;
 
+/**
+ * @ref SPI_TRANSACTION_STATUS_DEFINE
+ * 
+ * @brief The status of a transaction submitted to the SPI transaction engine.
+ */
+typedef enum{
+    SPI_TRANSACTION_IDLE,           /*Not submitted yet*/
+    SPI_TRANSACTION_PENDING,        /*Waiting in the instance queue*/
+    SPI_TRANSACTION_IN_FLIGHT,      /*Being exchanged on the bus*/
+    SPI_TRANSACTION_DONE,           /*All the frames have been exchanged*/
+    SPI_TRANSACTION_ABORTED         /*Dropped after a bus error with no retries left*/
+}eSPI_TransactionStatus_t;
+
+/**
+ * @brief Descriptor of a transaction for the SPI transaction engine, the descriptor must stay
+ * valid until its completion callback is called.
+ * 
+ */
+typedef struct sSPI_Transaction{
+    const uint8* pu8TxBuffer;       /*Frames to be sent, if NULL @ref SPI_TRANSACTION_DUMMY_FRAME is sent instead*/
+
+    uint8* pu8RxBuffer;             /*Where the received frames are stored, if NULL they are dropped*/
+
+    uint16 u16Length;               /*Number of frames to be exchanged, must be greater than zero*/
+
+    volatile GPIO_t* CS_Port;       /*Port of the slave select pin driven low during the transaction,
+                                        NULL if the slave has no select pin*/
+
+    uint16 CS_Pin;                  /*Slave select pin, must be a value of @ref GPIO_PIN_define*/
+
+    uint8 u8MaxRetries;             /*Number of times the transaction is restarted from its first frame after
+                                        a bus error (OVR/MODF) before it's aborted, 0 aborts on the first error*/
+
+    fptr_Callback fptr_OnComplete;  /*Called from the SPI ISR when the transaction is done or aborted (check eStatus),
+                                        can be NULL*/
+
+    struct sSPI_Transaction* psNext;    /*Transaction chained to this one, it starts right after this one
+                                            with the slave still selected, NULL to end the chain. If this one
+                                            is aborted the rest of the chain is aborted with it*/
+
+    volatile eSPI_TransactionStatus_t eStatus;  /*Set by the driver, must be a value of @ref SPI_TRANSACTION_STATUS_DEFINE*/
+}sSPI_Transaction_t;
+
+/**
+ * @brief Link error counters of an SPI instance used by the transaction engine, with the interrupt
+ * load of the instance. The CPU share taken by the instance over a period is the difference of
+ * u32InterruptCycles divided by the difference of MCAL_DWT_GetCycles() over the same period.
+ * 
+ */
+typedef struct{
+    uint32 u32OverrunCount;         /*Number of overrun (OVR) errors*/
+    uint32 u32ModeFaultCount;       /*Number of master mode fault (MODF) errors*/
+    uint32 u32RetryCount;           /*Number of transactions restarted after an error*/
+    uint32 u32AbortCount;           /*Number of transactions aborted after running out of retries*/
+    uint32 u32InterruptCount;       /*Number of times the instance interrupt handler ran*/
+    uint32 u32InterruptCycles;      /*Core cycles spent in the instance interrupt handler, wraps*/
+}sSPI_ErrorCounters_t;
+
 /**************************************************************************************************************************
 *===============================================
 *         Macros Configuration References
@@ -108,6 +167,15 @@ typedef struct {
 #define SPI_IRQ_RXNEIE                      0x00000040UL    
 #define SPI_IRQ_ERRIE                       0x00000020UL    
 
+/*Position of the IRQ enable bit in CR2 (ERRIE = 5, RXNEIE = 6, TXEIE = 7), IRQ must be a single flag*/
+#define SPI_IRQ_CR2_BIT_POS(IRQ)            (5 + ((IRQ) >> 6))
+#define SPI_IRQ_CR2_FIRST_BIT               5u
+#define SPI_IRQ_CR2_LAST_BIT                7u
+
+/*----------- @ref SPI_TRANSACTION_CONFIG ------------*/
+#define SPI_TRANSACTION_QUEUE_SIZE          4       /*Max number of pending transactions per SPI instance*/
+#define SPI_TRANSACTION_DUMMY_FRAME         0x00u   /*Frame sent when the transaction has no TX buffer*/
+
 enum Polling_mechanism{
     PollingEnable,
     PollingDisable
@@ -198,7 +266,7 @@ void MCAL_SPI_WAIT_TC(USART_Typedef * SPIx);
 * @Func_name	:   MCAL_SPI_Interrupt_EN
 * @brief		:   Enable a specific interrupt and set its callback function.
 * @param [in]	:   SPI: specifies the SPI instance, can be (SPI1, SPI2).
-* @param [in]	:   IRQ: specifies the interrupt to be enabled, must be set based on @ref SPI_IRQ_DEFINE.
+* @param [in]	:   IRQ: specifies the interrupts to be enabled, one or more flags of @ref SPI_IRQ_DEFINE OR-ed.
 * @param [in]	:   p_IRQ_callback: pointer to the callback function to be executed.
 * @return_value :   none.
 * Note          :   In case of interrupt from the MODF or OVR flag you need to clear the flag manually.======================================================================================================================
@@ -210,10 +278,47 @@ void MCAL_SPI_Interrupt_EN(volatile SPI_Typedef * SPIx, uint8 IRQ, void (* p_IRQ
 * @Func_name	:   MCAL_SPI_Interrupt_Disable
 * @brief		:   Disable a specific interrupt
 * @param [in]	:   SPI: specifies the SPI instance, can be (SPI1, SPI2).
-* @param [in]	:   IRQ: specifies the interrupt to be disabled, must be set based on @ref SPI_IRQ_DEFINE.
+* @param [in]	:   IRQ: specifies the interrupts to be disabled, one or more flags of @ref SPI_IRQ_DEFINE OR-ed.
 * @return_value :   none.
 * Note			:   This function won't disable the SPI instance interrupt in NVIC you have to manually disable it.
 ======================================================================================================================
 */
 void MCAL_SPI_Interrupt_Disable(volatile SPI_Typedef * SPIx, uint8 IRQ);
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_SPI_SubmitTransaction
+* @brief		:   Queue a transaction (or a chain of transactions) to be exchanged from the SPI ISR.
+* @param [in]	:   SPIx: specifies the SPI instance, can be (SPI1, SPI2).
+* @param [in]	:   transaction: the descriptor of the transaction, the head of the chain in case of chained transfers.
+* @return_value :   E_OK if the transaction was queued, E_NOK if the queue is full or the descriptor is invalid.
+* Note			:   The transactions of an instance run back to back in submission order using the RXNE and ERR
+*                   interrupts, so don't register your own callbacks or use the polling APIs on the same instance.
+*                   Only 8-bit frames are supported.
+======================================================================================================================
+*/
+eStatus_t MCAL_SPI_SubmitTransaction(volatile SPI_Typedef * SPIx, sSPI_Transaction_t* transaction);
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_SPI_GetErrorCounters
+* @brief		:   Get a snapshot of the link error counters of the transaction engine.
+* @param [in]	:   SPIx: specifies the SPI instance, can be (SPI1, SPI2).
+* @param [out]	:   counters: where the counters are copied.
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+void MCAL_SPI_GetErrorCounters(volatile SPI_Typedef * SPIx, sSPI_ErrorCounters_t* counters);
+
+/*
+======================================================================================================================
+* @Func_name	:   MCAL_SPI_ClearErrorCounters
+* @brief		:   Reset the link error counters of the transaction engine to zero.
+* @param [in]	:   SPIx: specifies the SPI instance, can be (SPI1, SPI2).
+* @return_value :   none.
+* Note			:   none.
+======================================================================================================================
+*/
+void MCAL_SPI_ClearErrorCounters(volatile SPI_Typedef * SPIx);
 #endif /* MCAL_SPI_STM32F103X8_SPI_H_ */
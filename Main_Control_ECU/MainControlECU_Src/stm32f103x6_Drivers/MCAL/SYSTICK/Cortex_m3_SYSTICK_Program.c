@@ -136,8 +136,7 @@ eStatus_t MCAL_SYST_Init(uint32 copy_ReloadVal)
         SYST->CVR = 0;
 
         /*3. Program Control and Status register.*/
-        SYST->CSR |= (SYST->CSR & ~(SYST_CSR_CLKSRC_MASK | SYST_CSR_TICKINT_MASK)); /*Clear the CLKSRC and TICKINT bits*/
-        SYST->CSR |= (SYST_CLKSRC | SYST_TICKINT);
+        SYST->CSR = (SYST->CSR & ~(SYST_CSR_CLKSRC_MASK | SYST_CSR_TICKINT_MASK)) | (SYST_CLKSRC | SYST_TICKINT);
     }else{
         LOC_estatus = E_NOK;
     }
@@ -410,5 +409,7 @@ void SysTick_Handler(void)
         Glob_SYSTCallback();
     }
 
-    SYST->CSR &= ~SYST_CSR_COUNT_FLAG_MASK;
+    /*Reading the CSR clears the COUNTFLAG, writing it back would race with the enable bits
+      (the SysTick is outside the bit-band region)*/
+    (void)SYST->CSR;
 }
\ No newline at end of file
@@ -27,7 +27,30 @@
 #define FLASH_MEMORY_BASE                             	0x08000000UL
 #define SYSTEM_MEMORY_BASE                            	0x08000000UL
 #define SRAM_MEMORY_BASE                              	0x20000000UL
-#define PERIPHERAL_MEMORY_BASE                        	0x20000000UL
+#define PERIPHERAL_MEMORY_BASE                        	0x40000000UL
+
+/*
+*===============================================
+*  	Cortex-M3 bit-band regions
+*===============================================
+*/
+#define SRAM_BITBAND_ALIAS_BASE                       	0x22000000UL
+#define PERIPHERAL_BITBAND_ALIAS_BASE                 	0x42000000UL
+
+/*
+ * Each bit of the first 1MB of the peripheral region is mapped to a whole word in the alias region,
+ * writing 0/1 to that word clears/sets the bit in a single store that can't be interrupted half way
+ * like the SET_BIT/CLEAR_BIT read-modify-write sequence.
+ * note: Don't use it on write-1-to-clear registers (e.g. EXTI_PR) as the bus does a read-modify-write
+ * of the whole register internally and would clear the other pending bits too.
+ * note: The Cortex-M3 private peripherals (NVIC, SysTick, ...) are outside the bit-band region.
+ */
+#define BITBAND_PERI_ALIAS(reg, bitNum)     (*((vuint32_t *)(PERIPHERAL_BITBAND_ALIAS_BASE + \
+                                            ((((uint32)&(reg)) - PERIPHERAL_MEMORY_BASE) << 5) + (((uint32)(bitNum)) << 2))))
+
+#define BITBAND_SET_BIT(reg, bitNum)        (BITBAND_PERI_ALIAS(reg, bitNum) = 1UL)
+#define BITBAND_CLEAR_BIT(reg, bitNum)      (BITBAND_PERI_ALIAS(reg, bitNum) = 0UL)
+#define BITBAND_READ_BIT(reg, bitNum)       (BITBAND_PERI_ALIAS(reg, bitNum))
 /*
 *===============================================
 *  	Cortex-M3 base addresses